@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <numeric>
+#include <print>
+#include <thread>
+#include <vector>
+#include "containers/concurrent_graph.hpp"
+#include "containers/graph.hpp"
+
+/**
+ * @brief Measures multi-producer edge ingestion throughput: a `Graph` serialized behind one mutex versus `ConcurrentGraph` writers, across thread counts.
+ * usage: bench_concurrent_graph [node-count] [edge-count] [max-threads]
+ */
+int main(int argc, char* argv[]) {
+    using namespace DerkLib;
+    using Clock = std::chrono::steady_clock;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    const auto node_count = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    const auto edge_count = (argc > 2) ? std::atoi(argv[2]) : 4000000;
+    const auto max_threads = (argc > 3) ? std::atoi(argv[3]) : static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+
+    std::vector<int> node_items (node_count);
+
+    std::iota(node_items.begin(), node_items.end(), 0);
+
+    auto runProducers = [&](int thread_count, auto&& produce) {
+        std::vector<std::thread> producers;
+        const auto start = Clock::now();
+
+        for (auto producer_id = 0; producer_id < thread_count; producer_id++) {
+            producers.emplace_back([&, producer_id]() {
+                unsigned int lcg_state = 7U + static_cast<unsigned int>(producer_id);
+                const auto edge_begin = static_cast<long long>(edge_count) * producer_id / thread_count;
+                const auto edge_end = static_cast<long long>(edge_count) * (producer_id + 1) / thread_count;
+
+                produce(edge_end - edge_begin, [&lcg_state, node_count]() {
+                    lcg_state = lcg_state * 1664525U + 1013904223U;
+
+                    return static_cast<int>((lcg_state >> 4) % static_cast<unsigned int>(node_count));
+                });
+            });
+        }
+
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    std::print("concurrent ingest: {} nodes, {} edges\n", node_count, edge_count);
+
+    for (auto thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int, Containers::Graph::LookupPolicy::hashed> locked_graph;
+        std::mutex graph_mutex;
+
+        for (const auto node : node_items) {
+            locked_graph.add(node);
+        }
+
+        const auto locked_seconds = runProducers(thread_count, [&](long long edges, auto&& nextNode) {
+            for (auto edge = 0LL; edge < edges; edge++) {
+                const auto from = nextNode();
+                const auto to = nextNode();
+                std::scoped_lock graph_lock {graph_mutex};
+
+                locked_graph.connectAt(from, to, EdgeDirection::one_way);
+            }
+        });
+
+        Containers::Graph::ConcurrentGraph<EdgeWeightPolicy::unweighted, int> shared_graph {node_items, 1 << 20};
+
+        const auto concurrent_seconds = runProducers(thread_count, [&](long long edges, auto&& nextNode) {
+            auto writer = shared_graph.writer();
+
+            for (auto edge = 0LL; edge < edges; edge++) {
+                const auto from = nextNode();
+
+                writer.connectAt(from, nextNode(), EdgeDirection::one_way);
+            }
+        });
+
+        std::print("threads {:>3}  mutex {:>8.2f} Medges/s  concurrent {:>8.2f} Medges/s\n", thread_count, edge_count / locked_seconds / 1e6, edge_count / concurrent_seconds / 1e6);
+    }
+}
@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <print>
+#include <thread>
+#include "containers/edge_list.hpp"
+
+/**
+ * @brief Writes a synthetic `src dst cost` edge list, then measures `loadEdgeList` parse & build throughput across thread counts. Run it twice to compare cold & page-cached reads.
+ * usage: bench_edge_list [edge-count] [max-threads]
+ */
+int main(int argc, char* argv[]) {
+    using namespace DerkLib;
+    using Clock = std::chrono::steady_clock;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+
+    const auto edge_count = (argc > 1) ? std::atoi(argv[1]) : 20000000;
+    const auto max_threads = (argc > 2) ? std::atoi(argv[2]) : static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+    const auto list_path = std::filesystem::temp_directory_path() / "derklib_bench.edges";
+
+    {
+        std::ofstream list_file {list_path, std::ios::binary};
+        unsigned int lcg_state = 5U;
+
+        for (auto edge = 0; edge < edge_count; edge++) {
+            lcg_state = lcg_state * 1664525U + 1013904223U;
+            const auto from = (lcg_state >> 4) % 4000000U;
+            lcg_state = lcg_state * 1664525U + 1013904223U;
+
+            list_file << from << ' ' << (lcg_state >> 4) % 4000000U << ' ' << (lcg_state & 0xFFU) << '\n';
+        }
+    }
+
+    const auto megabytes = static_cast<double>(std::filesystem::file_size(list_path)) / (1024.0 * 1024.0);
+
+    std::print("edge list: {} edges, {:.1f} MiB\n", edge_count, megabytes);
+
+    for (auto thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        const auto start = Clock::now();
+        const auto loaded = Containers::Graph::loadEdgeList<EdgeWeightPolicy::weighted>(list_path, {.thread_count = static_cast<unsigned int>(thread_count)});
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::print("threads {:>3}  load {:>8.1f} ms  {:>8.1f} MiB/s  nodes {}\n", thread_count, seconds * 1000.0, megabytes / seconds, loaded ? loaded->size() : 0);
+    }
+
+    std::filesystem::remove(list_path);
+}
@@ -0,0 +1,63 @@
+#include <chrono>
+#include <cstdlib>
+#include <print>
+#include <vector>
+#include "mathematics/elementwise.hpp"
+
+namespace {
+    using namespace DerkLib::Mathematics;
+
+    /// NOTE: keeps the compiler from hoisting or eliding the inlined scalar loops between repeats.
+    void clobberMemory() noexcept {
+        asm volatile ("" : : : "memory");
+    }
+
+    template <typename Op>
+    [[nodiscard]] double gibPerSecond(std::size_t bytes_per_call, int repeats, Op&& op) {
+        using Clock = std::chrono::steady_clock;
+
+        const auto start = Clock::now();
+
+        for (auto repeat = 0; repeat < repeats; repeat++) {
+            op();
+            clobberMemory();
+        }
+
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        return static_cast<double>(bytes_per_call) * repeats / seconds / (1024.0 * 1024.0 * 1024.0);
+    }
+
+    template <typename T>
+    void benchType(const char* type_name, std::size_t count, int repeats) {
+        std::vector<T> lhs (count, T {1});
+        std::vector<T> rhs (count, T {1});
+        const auto rhs_copy = rhs;
+        const auto& kernels = Matrices::Impl::elementwiseKernels<T>();
+        const auto bytes = count * sizeof(T);
+        bool all_equal = true;
+
+        const auto scalar_add = gibPerSecond(2 * bytes, repeats, [&]() { Matrices::Impl::addScalar(lhs.data(), rhs.data(), count); });
+        const auto simd_add = gibPerSecond(2 * bytes, repeats, [&]() { kernels.add(lhs.data(), rhs.data(), count); });
+        const auto scalar_scale = gibPerSecond(bytes, repeats, [&]() { Matrices::Impl::scaleScalar(lhs.data(), T {-1}, count); });
+        const auto simd_scale = gibPerSecond(bytes, repeats, [&]() { kernels.scale(lhs.data(), T {-1}, count); });
+        const auto scalar_equal = gibPerSecond(2 * bytes, repeats, [&]() { all_equal = Matrices::Impl::equalScalar(rhs_copy.data(), rhs.data(), count) and all_equal; });
+        const auto simd_equal = gibPerSecond(2 * bytes, repeats, [&]() { all_equal = kernels.equal(rhs_copy.data(), rhs.data(), count) and all_equal; });
+
+        std::print("{:>7}  add {:>6.1f} -> {:>6.1f}  scale {:>6.1f} -> {:>6.1f}  equal {:>6.1f} -> {:>6.1f} GiB/s  ({})\n", type_name, scalar_add, simd_add, scalar_scale, simd_scale, scalar_equal, simd_equal, all_equal);
+    }
+}
+
+/**
+ * @brief Measures the scalar loops against the runtime-dispatched SIMD element-wise kernels, over an L2-resident block by default.
+ * usage: bench_elementwise [element-count] [repeats]
+ */
+int main(int argc, char* argv[]) {
+    const auto count = static_cast<std::size_t>((argc > 1) ? std::atoi(argv[1]) : 16384);
+    const auto repeats = (argc > 2) ? std::atoi(argv[2]) : 20000;
+
+    benchType<float>("float", count, repeats);
+    benchType<double>("double", count, repeats);
+    benchType<std::int32_t>("int32", count, repeats);
+    benchType<std::int64_t>("int64", count, repeats);
+}
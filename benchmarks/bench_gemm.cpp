@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <print>
+#include "mathematics/dynamic_matrices.hpp"
+
+namespace {
+    using namespace DerkLib::Mathematics;
+
+    /// NOTE: the i-j-k triple loop `Matrix::operator*` used before blocking, walking `rhs` down its columns.
+    [[nodiscard]] Matrices::DynamicMatrix<double> naiveProduct(const Matrices::DynamicMatrix<double>& lhs, const Matrices::DynamicMatrix<double>& rhs) {
+        Matrices::DynamicMatrix<double> ans (lhs.rows(), rhs.cols());
+
+        for (auto row = 0; row < static_cast<int>(lhs.rows()); row++) {
+            for (auto col = 0; col < static_cast<int>(rhs.cols()); col++) {
+                for (auto depth_i = 0; depth_i < static_cast<int>(lhs.cols()); depth_i++) {
+                    ans[row, col] += lhs[row, depth_i] * rhs[depth_i, col];
+                }
+            }
+        }
+
+        return ans;
+    }
+
+    template <typename Multiply>
+    [[nodiscard]] double gflopsOf(std::size_t size, Multiply&& multiply) {
+        using Clock = std::chrono::steady_clock;
+
+        /// NOTE: repeat small sizes so every measurement covers at least ~0.2 s of work.
+        const auto repeats = std::max<std::size_t>(1, 400000000 / (size * size * size));
+        const auto start = Clock::now();
+
+        for (auto repeat = 0UL; repeat < repeats; repeat++) {
+            multiply();
+        }
+
+        const auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        return 2.0 * static_cast<double>(size * size * size) * static_cast<double>(repeats) / seconds * 1e-9;
+    }
+}
+
+/**
+ * @brief Measures square `double` matrix products of the naive triple loop against the cache-blocked `multiplyBlocked`, in GFLOP/s.
+ * usage: bench_gemm [max-size]
+ */
+int main(int argc, char* argv[]) {
+    const auto max_size = static_cast<std::size_t>((argc > 1) ? std::atoi(argv[1]) : 1024);
+
+    std::print("{:>6}  {:>12}  {:>12}  {:>8}\n", "size", "naive GF/s", "blocked GF/s", "speedup");
+
+    for (auto size = 64UL; size <= max_size; size *= 2) {
+        Matrices::DynamicMatrix<double> lhs (size, size);
+        Matrices::DynamicMatrix<double> rhs (size, size);
+
+        for (auto elem_idx = 0UL; elem_idx < size * size; elem_idx++) {
+            lhs.elements()[elem_idx] = static_cast<double>(elem_idx % 13) * 0.25;
+            rhs.elements()[elem_idx] = static_cast<double>(elem_idx % 7) * 0.5;
+        }
+
+        double checksum = 0.0;
+
+        const auto naive_gflops = gflopsOf(size, [&]() {
+            checksum += naiveProduct(lhs, rhs)[0, 0];
+        });
+
+        const auto blocked_gflops = gflopsOf(size, [&]() {
+            checksum += (lhs * rhs)[0, 0];
+        });
+
+        std::print("{:>6}  {:>12.2f}  {:>12.2f}  {:>7.1f}x  (checksum {})\n", size, naive_gflops, blocked_gflops, blocked_gflops / naive_gflops, checksum);
+    }
+}
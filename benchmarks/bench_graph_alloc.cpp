@@ -0,0 +1,114 @@
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <print>
+#include "containers/arena.hpp"
+#include "containers/graph.hpp"
+#include "algorithms/traversals.hpp"
+
+namespace {
+    std::size_t counted_bytes = 0;
+    std::size_t counted_allocations = 0;
+
+    /**
+     * @brief `std::allocator` wrapper tallying requested bytes, so the default adjacency layout can be measured. Excludes the malloc header each node also pays for.
+     */
+    template <typename U>
+    struct CountingAllocator {
+        using value_type = U;
+
+        CountingAllocator() = default;
+
+        template <typename V>
+        CountingAllocator([[maybe_unused]] const CountingAllocator<V>& other) noexcept {}
+
+        [[nodiscard]] U* allocate(std::size_t count) {
+            counted_bytes += count * sizeof(U);
+            ++counted_allocations;
+
+            return std::allocator<U> {}.allocate(count);
+        }
+
+        void deallocate(U* ptr, std::size_t count) noexcept {
+            std::allocator<U> {}.deallocate(ptr, count);
+        }
+
+        template <typename V>
+        [[nodiscard]] bool operator==([[maybe_unused]] const CountingAllocator<V>& other) const noexcept {
+            return true;
+        }
+    };
+}
+
+/**
+ * @brief Compares `Graph` edge ingestion (`connectAt`), BFS & teardown with the default allocator against `Memory::ArenaAllocator`.
+ * usage: bench_graph_alloc [node-count] [edges-per-node]
+ */
+int main(int argc, char* argv[]) {
+    using namespace DerkLib;
+    using Clock = std::chrono::steady_clock;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+    using Lookup = Containers::Graph::LookupPolicy;
+
+    const auto node_count = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    const auto edges_per_node = (argc > 2) ? std::atoi(argv[2]) : 16;
+
+    auto elapsedMs = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    };
+
+    auto runCase = [&](const char* label, auto& graph, auto&& report_memory) {
+        unsigned int lcg_state = 99U;
+
+        for (auto node = 0; node < node_count; node++) {
+            graph.add(node);
+        }
+
+        auto start = Clock::now();
+
+        for (auto node = 0; node < node_count; node++) {
+            for (auto link = 0; link < edges_per_node; link++) {
+                lcg_state = lcg_state * 1664525U + 1013904223U;
+                graph.connectAt(node, static_cast<int>((lcg_state >> 4) % static_cast<unsigned int>(node_count)), EdgeDirection::one_way);
+            }
+        }
+
+        const auto build_ms = elapsedMs(start);
+
+        start = Clock::now();
+        const auto reached = Algorithms::Graph::searchBFS(graph, 0).order.size();
+        const auto bfs_ms = elapsedMs(start);
+
+        std::print("{:<10} connect {:>9.2f} ms  bfs {:>8.2f} ms  reached {:>8}  ", label, build_ms, bfs_ms, reached);
+        report_memory();
+    };
+
+    std::print("graph alloc: {} nodes, {} edges\n", node_count, static_cast<long long>(node_count) * edges_per_node);
+
+    {
+        auto graph = std::make_unique<Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int, Lookup::hashed, CountingAllocator>>();
+
+        runCase("default", *graph, [] {
+            std::print("edge bytes {:>12}  allocations {:>10}\n", counted_bytes, counted_allocations);
+        });
+
+        const auto start = Clock::now();
+        graph.reset();
+        std::print("{:<10} teardown {:>9.2f} ms\n", "default", elapsedMs(start));
+    }
+
+    {
+        Containers::Memory::Arena edge_arena {1 << 20};
+        auto graph = std::make_unique<Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int, Lookup::hashed, Containers::Memory::ArenaAllocator>>(Containers::Memory::ArenaAllocator<int> {edge_arena});
+
+        runCase("arena", *graph, [&edge_arena] {
+            std::print("edge bytes {:>12}  chunks {:>15}\n", edge_arena.bytesReserved(), edge_arena.chunkCount());
+        });
+
+        const auto start = Clock::now();
+        graph.reset();
+        edge_arena.release();
+        std::print("{:<10} teardown {:>9.2f} ms\n", "arena", elapsedMs(start));
+    }
+}
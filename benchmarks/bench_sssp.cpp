@@ -0,0 +1,64 @@
+#include <chrono>
+#include <cstdlib>
+#include <print>
+#include <thread>
+#include "containers/graph.hpp"
+#include "algorithms/shortest_paths.hpp"
+
+/**
+ * @brief Times serial Dijkstra against delta-stepping at several worker counts over a pseudo-random weighted graph.
+ * usage: bench_sssp [node-count] [edges-per-node]
+ */
+int main(int argc, char* argv[]) {
+    using namespace DerkLib;
+    using Clock = std::chrono::steady_clock;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    const auto node_count = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    const auto edges_per_node = (argc > 2) ? std::atoi(argv[2]) : 10;
+
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, int> network;
+    unsigned int lcg_state = 7U;
+
+    auto nextRandom = [&lcg_state](unsigned int bound) noexcept {
+        lcg_state = lcg_state * 1664525U + 1013904223U;
+        return static_cast<int>((lcg_state >> 4) % bound);
+    };
+
+    for (auto node = 0; node < node_count; node++) {
+        network.add(node);
+    }
+
+    for (auto node = 0; node < node_count; node++) {
+        for (auto link = 0; link < edges_per_node; link++) {
+            network.connectAt(node, nextRandom(static_cast<unsigned int>(node_count)), 1 + nextRandom(1000), EdgeDirection::one_way);
+        }
+    }
+
+    const auto frozen_network = network.freeze();
+
+    auto timeMs = [](auto&& action) {
+        const auto start = Clock::now();
+        auto result = action();
+        const auto elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        return std::pair {elapsed, std::move(result)};
+    };
+
+    std::print("sssp: {} nodes, {} edges\n", frozen_network.size(), frozen_network.edgeCount());
+
+    const auto [dijkstra_ms, dijkstra_paths] = timeMs([&] {
+        return Algorithms::Graph::searchDijkstra(frozen_network, 0);
+    });
+
+    std::print("{:<28} {:>10.2f} ms\n", "dijkstra (serial)", dijkstra_ms);
+
+    for (auto worker_count = 1U; worker_count <= std::max(std::thread::hardware_concurrency(), 1U); worker_count *= 2) {
+        const auto [stepping_ms, stepping_paths] = timeMs([&] {
+            return Algorithms::Graph::searchDeltaStepping(frozen_network, 0, 0LL, worker_count);
+        });
+
+        std::print("{:<20} x{:<6} {:>10.2f} ms  speedup {:>5.2f}  {}\n", "delta-stepping", worker_count, stepping_ms, dijkstra_ms / stepping_ms, (stepping_paths.distances == dijkstra_paths.distances) ? "ok" : "MISMATCH");
+    }
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "containers/graph.hpp"
+#include "meta/graphs.hpp"
+
+namespace DerkLib::Algorithms::Graph {
+    /**
+     * @brief Disjoint-set forest over `[0, size())` with union by rank & path compression, giving near-constant amortized `find` & `unite`.
+     */
+    class UnionFind {
+    private:
+        std::vector<int> m_parents;
+        std::vector<unsigned char> m_ranks;
+        std::size_t m_set_count;
+
+    public:
+        UnionFind()
+        : m_parents {}, m_ranks {}, m_set_count {0} {}
+
+        explicit UnionFind(std::size_t size)
+        : m_parents (size), m_ranks (size, 0), m_set_count {size} {
+            for (auto element = 0; element < static_cast<int>(size); element++) {
+                m_parents[element] = element;
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_parents.size();
+        }
+
+        [[nodiscard]] std::size_t setCount() const noexcept {
+            return m_set_count;
+        }
+
+        [[nodiscard]] int find(int element) noexcept {
+            auto root = element;
+
+            while (m_parents[root] != root) {
+                root = m_parents[root];
+            }
+
+            /// NOTE: second pass points the whole walked path straight at the root.
+            while (m_parents[element] != root) {
+                element = std::exchange(m_parents[element], root);
+            }
+
+            return root;
+        }
+
+        /**
+         * @brief Merges the sets of `lhs` & `rhs`, returning whether they were separate.
+         */
+        bool unite(int lhs, int rhs) noexcept {
+            auto lhs_root = find(lhs);
+            auto rhs_root = find(rhs);
+
+            if (lhs_root == rhs_root) {
+                return false;
+            }
+
+            if (m_ranks[lhs_root] < m_ranks[rhs_root]) {
+                std::swap(lhs_root, rhs_root);
+            }
+
+            m_parents[rhs_root] = lhs_root;
+
+            if (m_ranks[lhs_root] == m_ranks[rhs_root]) {
+                ++m_ranks[lhs_root];
+            }
+
+            --m_set_count;
+
+            return true;
+        }
+
+        [[nodiscard]] bool connected(int lhs, int rhs) noexcept {
+            return find(lhs) == find(rhs);
+        }
+    };
+
+    /**
+     * @brief Per-node component labels, numbered densely from 0 in order of each component's lowest node index.
+     */
+    struct ComponentsResult {
+        std::vector<int> labels;
+        int count;
+    };
+
+    namespace Impl {
+        /**
+         * @brief Renumbers per-node roots into dense labels, in order of first appearance.
+         */
+        template <typename FindRoot>
+        [[nodiscard]] ComponentsResult denseLabels(std::size_t node_count, FindRoot&& find_root) {
+            ComponentsResult result {
+                .labels = std::vector<int>(node_count),
+                .count = 0
+            };
+            std::vector<int> root_labels (node_count, -1);
+
+            for (auto node = 0; node < static_cast<int>(node_count); node++) {
+                auto& root_label = root_labels[find_root(node)];
+
+                if (root_label < 0) {
+                    root_label = result.count++;
+                }
+
+                result.labels[node] = root_label;
+            }
+
+            return result;
+        }
+    }
+
+    /**
+     * @brief Labels the connected components of a two-way graph by uniting the endpoints of every edge. On a one-way graph this yields weakly connected components.
+     * 
+     * @param arg 
+     * @return ComponentsResult 
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] ComponentsResult labelComponents(const G& arg) {
+        const auto node_count = arg.size();
+        UnionFind sets (node_count);
+
+        for (auto node = 0; node < static_cast<int>(node_count); node++) {
+            for (const auto& edge : arg.neighbors(node)) {
+                sets.unite(node, Containers::Graph::destinationOf(edge));
+            }
+        }
+
+        return Impl::denseLabels(node_count, [&sets](int node) noexcept {
+            return sets.find(node);
+        });
+    }
+
+    /**
+     * @brief Parallel variant of `labelComponents` in the Shiloach–Vishkin style, over `thread_count` workers counting the calling thread. Workers take node chunks from a shared cursor. For each edge they hook the larger of the two current roots under the smaller with a CAS, so every tree stays rooted at its lowest index. Finds shorten paths by pointer-halving as they go. Labels equal `labelComponents`.
+     * 
+     * @param arg a graph whose const `neighbors(index)` is safe to call concurrently
+     * @param thread_count number of workers (at least 1)
+     * @return ComponentsResult 
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] ComponentsResult labelComponentsParallel(const G& arg, unsigned int thread_count = std::thread::hardware_concurrency()) {
+        constexpr std::size_t chunk_size = 256;
+        const auto node_count = arg.size();
+        const auto worker_count = std::max(thread_count, 1U);
+        auto parents = std::make_unique<std::atomic<int>[]>(node_count);
+        std::atomic<std::size_t> node_cursor {0};
+
+        for (auto node = 0; node < static_cast<int>(node_count); node++) {
+            parents[node].store(node, std::memory_order_relaxed);
+        }
+
+        auto findRoot = [&parents](int node) noexcept {
+            while (true) {
+                auto parent = parents[node].load(std::memory_order_relaxed);
+
+                if (parent == node) {
+                    return node;
+                }
+
+                /// NOTE: pointer-halving only ever redirects a node to one of its ancestors, so a lost race is harmless.
+                if (const auto grandparent = parents[parent].load(std::memory_order_relaxed); grandparent != parent) {
+                    parents[node].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+                }
+
+                node = parent;
+            }
+        };
+
+        auto hookEdges = [&]() {
+            for (auto chunk_begin = node_cursor.fetch_add(chunk_size, std::memory_order_relaxed); chunk_begin < node_count; chunk_begin = node_cursor.fetch_add(chunk_size, std::memory_order_relaxed)) {
+                const auto chunk_end = std::min(chunk_begin + chunk_size, node_count);
+
+                for (auto node = static_cast<int>(chunk_begin); node < static_cast<int>(chunk_end); node++) {
+                    for (const auto& edge : arg.neighbors(node)) {
+                        auto lhs_root = findRoot(node);
+                        auto rhs_root = findRoot(Containers::Graph::destinationOf(edge));
+
+                        while (lhs_root != rhs_root) {
+                            auto high_root = std::max(lhs_root, rhs_root);
+
+                            if (parents[high_root].compare_exchange_strong(high_root, std::min(lhs_root, rhs_root), std::memory_order_relaxed)) {
+                                break;
+                            }
+
+                            lhs_root = findRoot(lhs_root);
+                            rhs_root = findRoot(rhs_root);
+                        }
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(worker_count - 1);
+
+        for (auto worker_id = 1U; worker_id < worker_count; worker_id++) {
+            workers.emplace_back(hookEdges);
+        }
+
+        hookEdges();
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        return Impl::denseLabels(node_count, findRoot);
+    }
+}
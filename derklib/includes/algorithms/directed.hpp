@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+#include "containers/bitset.hpp"
+#include "containers/graph.hpp"
+#include "algorithms/components.hpp"
+#include "algorithms/traversals.hpp"
+#include "meta/graphs.hpp"
+
+namespace DerkLib::Algorithms::Graph {
+    /**
+     * @brief Labels the strongly connected components of a one-way graph with Tarjan's algorithm. The DFS uses an explicit stack of neighbor-iterator frames, and per-node state lives in flat arrays (discovery index, low-link, on-stack bit), so deep graphs with millions of nodes need neither recursion nor per-node allocation. Components are numbered in the order Tarjan completes them, which is a reverse topological order of the condensation: every edge between components runs from a higher label to a lower or equal one.
+     * 
+     * @param arg 
+     * @return ComponentsResult 
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] ComponentsResult labelStrongComponents(const G& arg) {
+        const auto node_count = static_cast<int>(arg.size());
+        std::vector<int> discovery (node_count, no_node);
+        std::vector<int> low_links (node_count);
+        std::vector<int> pending;
+        std::vector<Impl::DfsFrame<G>> frames;
+        Containers::Bitset::DynamicBitset on_pending (arg.size());
+        ComponentsResult result {
+            .labels = std::vector<int>(node_count, no_node),
+            .count = 0
+        };
+        auto next_discovery = 0;
+
+        auto discover = [&](int node) {
+            discovery[node] = next_discovery;
+            low_links[node] = next_discovery;
+            ++next_discovery;
+            pending.emplace_back(node);
+            on_pending.set(node);
+            frames.emplace_back(Impl::dfsFrameOf(arg, node));
+        };
+
+        for (auto root = 0; root < node_count; root++) {
+            if (discovery[root] != no_node) {
+                continue;
+            }
+
+            discover(root);
+
+            while (not frames.empty()) {
+                auto& top = frames.back();
+                const auto temp = top.node;
+
+                if (top.next != top.end) {
+                    if (const auto adj_index = Containers::Graph::destinationOf(*top.next++); discovery[adj_index] == no_node) {
+                        discover(adj_index);
+                    } else if (on_pending.test(adj_index)) {
+                        low_links[temp] = std::min(low_links[temp], discovery[adj_index]);
+                    }
+
+                    continue;
+                }
+
+                frames.pop_back();
+
+                if (not frames.empty()) {
+                    const auto parent = frames.back().node;
+
+                    low_links[parent] = std::min(low_links[parent], low_links[temp]);
+                }
+
+                /// NOTE: `temp` roots a component, which is everything pushed onto `pending` since it.
+                if (low_links[temp] == discovery[temp]) {
+                    int member;
+
+                    do {
+                        member = pending.back();
+                        pending.pop_back();
+                        on_pending.reset(member);
+                        result.labels[member] = result.count;
+                    } while (member != temp);
+
+                    ++result.count;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Orders the nodes of a one-way graph so every edge points forward, using Kahn's algorithm. In-degrees are counted into one flat array, and the output vector doubles as the FIFO queue of ready nodes, so the sort makes no per-node allocations. Ties are broken by ascending index for sources and by edge order after that.
+     * 
+     * @param arg 
+     * @return std::optional<std::vector<int>> node indices in topological order, or empty if the graph has a cycle
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::optional<std::vector<int>> sortTopologically(const G& arg) {
+        const auto node_count = static_cast<int>(arg.size());
+        std::vector<int> in_degrees (node_count, 0);
+        std::vector<int> order;
+
+        for (auto node = 0; node < node_count; node++) {
+            for (const auto& edge : arg.neighbors(node)) {
+                ++in_degrees[Containers::Graph::destinationOf(edge)];
+            }
+        }
+
+        order.reserve(node_count);
+
+        for (auto node = 0; node < node_count; node++) {
+            if (in_degrees[node] == 0) {
+                order.emplace_back(node);
+            }
+        }
+
+        for (std::size_t order_head = 0; order_head < order.size(); order_head++) {
+            for (const auto& edge : arg.neighbors(order[order_head])) {
+                if (const auto adj_index = Containers::Graph::destinationOf(edge); --in_degrees[adj_index] == 0) {
+                    order.emplace_back(adj_index);
+                }
+            }
+        }
+
+        if (static_cast<int>(order.size()) != node_count) {
+            return {};
+        }
+
+        return order;
+    }
+}
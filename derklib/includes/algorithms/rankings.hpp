@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <barrier>
+#include <cmath>
+#include <iterator>
+#include <ranges>
+#include <thread>
+#include <vector>
+#include "containers/graph.hpp"
+#include "meta/graphs.hpp"
+
+namespace DerkLib::Algorithms::Graph {
+    /**
+     * @brief Tuning for `computePageRank`. Iteration stops once the L1 change between rank vectors drops below `tolerance`, or after `max_iterations`.
+     */
+    struct PageRankConfig {
+        double damping = 0.85;
+        double tolerance = 1e-6;
+        int max_iterations = 100;
+        unsigned int thread_count = 1;
+    };
+
+    struct PageRankResult {
+        std::vector<double> ranks;
+        int iterations;
+        double residual;
+    };
+
+    /**
+     * @brief Pull-based PageRank. The in-edges are packed once into a transposed CSR. Each iteration then makes two streaming passes over contiguous arrays: one fills `contributions[u] = rank[u] / out_degree[u]`, the other has every node sum the contributions of its in-neighbors into the back rank buffer. Dangling nodes spread their rank uniformly. With `thread_count > 1`, each pass is split into node blocks of roughly equal in-edge counts, and per-worker partial sums are reduced at a barrier.
+     * 
+     * @param arg a graph whose const `neighbors(index)` is safe to call concurrently
+     * @param config 
+     * @return PageRankResult ranks summing to 1 (empty for an empty graph)
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] PageRankResult computePageRank(const G& arg, PageRankConfig config = {}) {
+        struct alignas(64) PartialSum {
+            double value;
+        };
+
+        const auto node_count = static_cast<int>(arg.size());
+
+        if (node_count == 0) {
+            return {.ranks = {}, .iterations = 0, .residual = 0.0};
+        }
+
+        const auto reverse = Containers::Graph::transposeOf(arg);
+        const auto in_offsets = reverse.offsets();
+        const auto in_sources = reverse.targets();
+        const auto worker_count = static_cast<int>(std::max(config.thread_count, 1U));
+        const auto uniform_share = 1.0 / node_count;
+        const auto teleport_share = (1.0 - config.damping) * uniform_share;
+        std::vector<int> out_degrees (node_count);
+        std::vector<double> contributions (node_count);
+        std::vector<double> next_ranks (node_count);
+        std::vector<PartialSum> dangling_partials (worker_count);
+        std::vector<PartialSum> residual_partials (worker_count);
+        std::vector<int> block_bounds (worker_count + 1, node_count);
+        double dangling_share = 0.0;
+        auto done = config.max_iterations <= 0;
+        PageRankResult result {
+            .ranks = std::vector<double>(node_count, uniform_share),
+            .iterations = 0,
+            .residual = 0.0
+        };
+
+        for (auto node = 0; node < node_count; node++) {
+            out_degrees[node] = static_cast<int>(std::ranges::distance(arg.neighbors(node)));
+        }
+
+        /// NOTE: block `w` covers nodes `[block_bounds[w], block_bounds[w + 1])`, cut where the running in-edge count passes `w / worker_count` of the total.
+        block_bounds[0] = 0;
+
+        for (auto worker = 1; worker < worker_count; worker++) {
+            const auto edge_goal = static_cast<long long>(in_sources.size()) * worker / worker_count;
+
+            block_bounds[worker] = std::max(block_bounds[worker - 1], static_cast<int>(std::lower_bound(in_offsets.begin(), in_offsets.end() - 1, edge_goal) - in_offsets.begin()));
+        }
+
+        auto spreadDangling = [&]() noexcept {
+            auto dangling_rank = 0.0;
+
+            for (const auto& partial : dangling_partials) {
+                dangling_rank += partial.value;
+            }
+
+            dangling_share = config.damping * dangling_rank * uniform_share;
+        };
+
+        auto finishIteration = [&]() noexcept {
+            result.residual = 0.0;
+
+            for (const auto& partial : residual_partials) {
+                result.residual += partial.value;
+            }
+
+            std::swap(result.ranks, next_ranks);
+            ++result.iterations;
+            done = result.residual < config.tolerance or result.iterations >= config.max_iterations;
+        };
+
+        std::barrier contribute_sync (worker_count, spreadDangling);
+        std::barrier gather_sync (worker_count, finishIteration);
+
+        auto iterateBlock = [&](int worker_id) {
+            const auto block_begin = block_bounds[worker_id];
+            const auto block_end = block_bounds[worker_id + 1];
+
+            while (not done) {
+                const auto* ranks = result.ranks.data();
+                auto dangling_rank = 0.0;
+
+                for (auto node = block_begin; node < block_end; node++) {
+                    if (const auto out_degree = out_degrees[node]; out_degree > 0) {
+                        contributions[node] = ranks[node] / out_degree;
+                    } else {
+                        contributions[node] = 0.0;
+                        dangling_rank += ranks[node];
+                    }
+                }
+
+                dangling_partials[worker_id].value = dangling_rank;
+                contribute_sync.arrive_and_wait();
+
+                auto residual = 0.0;
+
+                for (auto node = block_begin; node < block_end; node++) {
+                    auto pulled = 0.0;
+
+                    for (auto in_slot = in_offsets[node]; in_slot < in_offsets[node + 1]; in_slot++) {
+                        pulled += contributions[in_sources[in_slot]];
+                    }
+
+                    next_ranks[node] = teleport_share + dangling_share + config.damping * pulled;
+                    residual += std::abs(next_ranks[node] - ranks[node]);
+                }
+
+                residual_partials[worker_id].value = residual;
+                gather_sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(worker_count - 1);
+
+        for (auto worker_id = 1; worker_id < worker_count; worker_id++) {
+            workers.emplace_back(iterateBlock, worker_id);
+        }
+
+        iterateBlock(0);
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "containers/bitset.hpp"
+#include "containers/graph.hpp"
+#include "meta/graphs.hpp"
+
+namespace DerkLib::Algorithms::Graph {
+    enum class ReorderPolicy {
+        reverse_cuthill_mckee,
+        degree_descending,
+        bfs
+    };
+
+    namespace Impl {
+        /**
+         * @brief Inverts a visiting order (`order[position] = old index`) into the `new_indices[old index] = position` form taken by `Graph::permute`.
+         */
+        [[nodiscard]] inline std::vector<int> newIndicesOf(const std::vector<int>& order) {
+            std::vector<int> new_indices (order.size());
+
+            for (auto position = 0; position < static_cast<int>(order.size()); position++) {
+                new_indices[order[position]] = position;
+            }
+
+            return new_indices;
+        }
+
+        template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+        [[nodiscard]] std::vector<int> outDegreesOf(const G& arg) {
+            std::vector<int> degrees (arg.size());
+
+            for (auto node = 0; node < static_cast<int>(arg.size()); node++) {
+                degrees[node] = static_cast<int>(std::ranges::distance(arg.neighbors(node)));
+            }
+
+            return degrees;
+        }
+    }
+
+    /**
+     * @brief Numbers nodes by breadth-first visiting order, restarting from the lowest unvisited index for every disconnected part. Neighbors then tend to sit near each other in memory.
+     * 
+     * @return std::vector<int> the new index of each old index
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::vector<int> orderByBFS(const G& arg) {
+        const auto node_count = static_cast<int>(arg.size());
+        std::vector<int> order;
+        Containers::Bitset::DynamicBitset visited (arg.size());
+
+        order.reserve(node_count);
+
+        for (auto seed = 0; seed < node_count; seed++) {
+            if (visited.testAndSet(seed)) {
+                continue;
+            }
+
+            order.emplace_back(seed);
+
+            /// NOTE: `order` doubles as the BFS queue, with `head` trailing its tail.
+            for (auto head = order.size() - 1; head < order.size(); head++) {
+                for (const auto& edge : arg.neighbors(order[head])) {
+                    if (const auto next = Containers::Graph::destinationOf(edge); not visited.testAndSet(next)) {
+                        order.emplace_back(next);
+                    }
+                }
+            }
+        }
+
+        return Impl::newIndicesOf(order);
+    }
+
+    /**
+     * @brief Numbers nodes by descending out-degree, keeping index order among ties, so that hub nodes share the hottest cache lines.
+     * 
+     * @return std::vector<int> the new index of each old index
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::vector<int> orderByDegree(const G& arg) {
+        const auto degrees = Impl::outDegreesOf(arg);
+        std::vector<int> order (arg.size());
+
+        for (auto node = 0; node < static_cast<int>(order.size()); node++) {
+            order[node] = node;
+        }
+
+        std::ranges::stable_sort(order, [&degrees](int lhs, int rhs) noexcept {
+            return degrees[lhs] > degrees[rhs];
+        });
+
+        return Impl::newIndicesOf(order);
+    }
+
+    /**
+     * @brief Reverse Cuthill-McKee numbering, which shrinks the bandwidth `max |new(u) - new(v)|` over edges. Each disconnected part is seeded from its lowest-degree node, neighbors are enqueued by ascending degree, and the final order is reversed. Meant for `two_way` graphs; one-way graphs only follow out-edges.
+     * 
+     * @return std::vector<int> the new index of each old index
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::vector<int> orderByReverseCuthillMcKee(const G& arg) {
+        const auto node_count = static_cast<int>(arg.size());
+        const auto degrees = Impl::outDegreesOf(arg);
+        std::vector<int> seeds (node_count);
+        std::vector<int> order;
+        std::vector<int> fresh_neighbors;
+        Containers::Bitset::DynamicBitset visited (arg.size());
+
+        auto byDegree = [&degrees](int lhs, int rhs) noexcept {
+            return degrees[lhs] < degrees[rhs];
+        };
+
+        for (auto node = 0; node < node_count; node++) {
+            seeds[node] = node;
+        }
+
+        std::ranges::stable_sort(seeds, byDegree);
+        order.reserve(node_count);
+
+        for (const auto seed : seeds) {
+            if (visited.testAndSet(seed)) {
+                continue;
+            }
+
+            order.emplace_back(seed);
+
+            for (auto head = order.size() - 1; head < order.size(); head++) {
+                fresh_neighbors.clear();
+
+                for (const auto& edge : arg.neighbors(order[head])) {
+                    if (const auto next = Containers::Graph::destinationOf(edge); not visited.testAndSet(next)) {
+                        fresh_neighbors.emplace_back(next);
+                    }
+                }
+
+                std::ranges::sort(fresh_neighbors, [&degrees](int lhs, int rhs) noexcept {
+                    return degrees[lhs] < degrees[rhs] or (degrees[lhs] == degrees[rhs] and lhs < rhs);
+                });
+                order.insert(order.end(), fresh_neighbors.cbegin(), fresh_neighbors.cend());
+            }
+        }
+
+        std::ranges::reverse(order);
+
+        return Impl::newIndicesOf(order);
+    }
+
+    /**
+     * @brief Renumbers `arg` in place by the chosen ordering so later traversals walk memory more sequentially. Pass the returned mapping to translate any indices held from before the call.
+     * 
+     * @param arg a graph with `permute(new_indices)`, e.g. `Containers::Graph::Graph`
+     * @return std::vector<int> the new index of each old index
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G> and requires (G& graph, std::span<const int> new_indices) { graph.permute(new_indices); })
+    std::vector<int> reorderGraph(G& arg, ReorderPolicy policy) {
+        std::vector<int> new_indices;
+
+        switch (policy) {
+            case ReorderPolicy::reverse_cuthill_mckee:
+                new_indices = orderByReverseCuthillMcKee(arg);
+                break;
+            case ReorderPolicy::degree_descending:
+                new_indices = orderByDegree(arg);
+                break;
+            case ReorderPolicy::bfs:
+                new_indices = orderByBFS(arg);
+                break;
+        }
+
+        arg.permute(new_indices);
+
+        return new_indices;
+    }
+}
@@ -0,0 +1,672 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "containers/bitset.hpp"
+#include "algorithms/traversals.hpp"
+#include "containers/graph.hpp"
+#include "containers/heaps.hpp"
+#include "meta/graphs.hpp"
+
+namespace DerkLib::Algorithms::Graph {
+    /**
+     * @brief Alias for the accumulated path-cost type of a weighted graph: integral costs widen to `long long` so long paths do not overflow, and floating costs are kept as-is.
+     * 
+     * @tparam G 
+     */
+    template <typename G>
+    using PathCostOf = std::conditional_t<std::is_floating_point_v<Meta::Graphs::GraphCostOf<G>>, Meta::Graphs::GraphCostOf<G>, long long>;
+
+    /// NOTE: marks a node that no path reaches in `PathsResult::distances`.
+    template <typename Distance>
+    constexpr Distance unreachable_cost = std::numeric_limits<Distance>::max();
+
+    /**
+     * @brief Result of a single-source shortest-path search, indexed by node. Unreached nodes hold `unreachable_cost<Distance>` with a `no_node` parent, and the source's parent is also `no_node`.
+     * 
+     * @tparam Distance 
+     */
+    template <typename Distance>
+    struct PathsResult {
+        std::vector<Distance> distances;
+        std::vector<int> parents;
+    };
+
+    /**
+     * @brief Walks a parents array (from `searchBFS`, `searchDijkstra`, ...) back from `target`, returning the node indices from `source` to `target`. Returns an empty path if `target` was not reached from `source`.
+     * 
+     * @param parents 
+     * @param source 
+     * @param target 
+     */
+    [[nodiscard]] inline std::vector<int> tracePath(const std::vector<int>& parents, int source, int target) {
+        std::vector<int> path;
+
+        if (target < 0 or static_cast<std::size_t>(target) >= parents.size()) {
+            return path;
+        }
+
+        for (auto node = target; node != no_node; node = parents[node]) {
+            path.emplace_back(node);
+        }
+
+        if (path.back() != source) {
+            return {};
+        }
+
+        std::reverse(path.begin(), path.end());
+
+        return path;
+    }
+
+    /**
+     * @brief Dijkstra's single-source shortest paths over non-negative edge costs. The queue is a 4-ary `IndexedDaryHeap` keyed by node index, so each improved distance is a decrease-key rather than a stale duplicate entry.
+     * 
+     * @param arg any `WeightedGraphKind`, e.g. `Graph<PathPolicy::weighted, T>` or its `CsrGraph` snapshot
+     * @param source index of the start node
+     * @return PathsResult<PathCostOf<G>> (empty if `source` is out of range)
+     */
+    template <typename G> requires (Meta::Graphs::WeightedGraphKind<G>)
+    [[nodiscard]] auto searchDijkstra(const G& arg, int source) -> PathsResult<PathCostOf<G>> {
+        using Distance = PathCostOf<G>;
+
+        const auto node_count = arg.size();
+
+        if (source < 0 or static_cast<std::size_t>(source) >= node_count) {
+            return {};
+        }
+
+        PathsResult<Distance> result {
+            .distances = std::vector<Distance>(node_count, unreachable_cost<Distance>),
+            .parents = std::vector<int>(node_count, no_node)
+        };
+        Containers::Heaps::IndexedDaryHeap<Distance, 4> pending (node_count);
+
+        result.distances[source] = Distance {};
+        pending.pushOrDecrease(source, Distance {});
+
+        while (not pending.empty()) {
+            const auto [temp_distance, temp] = pending.pop();
+
+            for (const auto& [cost, adj_index] : arg.neighbors(temp)) {
+                if (const auto via_temp = temp_distance + static_cast<Distance>(cost); via_temp < result.distances[adj_index]) {
+                    result.distances[adj_index] = via_temp;
+                    result.parents[adj_index] = temp;
+                    pending.pushOrDecrease(adj_index, via_temp);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    namespace Impl {
+        /**
+         * @brief A pending improvement `distances[node] = distance` reached via `parent`, produced while scanning edges and applied by the thread that owns `node`.
+         */
+        template <typename Distance>
+        struct RelaxRequest {
+            Distance distance;
+            int node;
+            int parent;
+        };
+
+        /// NOTE: upper bound on the cyclic bucket ring of `searchDeltaStepping`, so its per-worker buckets & next-bucket scans stay small regardless of graph size or `delta`.
+        inline constexpr std::size_t max_delta_buckets = 1024;
+    }
+
+    /**
+     * @brief Parallel delta-stepping single-source shortest paths over non-negative edge costs. Tentative distances are grouped into buckets of width `delta`. Each bucket is drained over `thread_count` workers, counting the calling thread: first by repeated light-edge (`cost <= delta`) relaxations, then by one heavy-edge pass over every node it settled. Scan phases only read distances and emit requests into per-owner buffers; in the following phase each worker applies the requests for the nodes it owns (`node % thread_count`). Because of this split, distance updates need no atomics and distances match `searchDijkstra` exactly.
+     * 
+     * @param arg a `WeightedGraphKind` whose const `neighbors(index)` is safe to call concurrently
+     * @param source index of the start node
+     * @param delta bucket width, or a non-positive value to derive it from the maximum edge cost & average degree; raised so that at most `min(node_count, 1022)` buckets of width `delta` cover `max_cost`
+     * @param thread_count number of workers (at least 1)
+     * @return PathsResult<PathCostOf<G>> (empty if `source` is out of range)
+     */
+    template <typename G> requires (Meta::Graphs::WeightedGraphKind<G>)
+    [[nodiscard]] auto searchDeltaStepping(const G& arg, int source, PathCostOf<G> delta = {}, unsigned int thread_count = std::thread::hardware_concurrency()) -> PathsResult<PathCostOf<G>> {
+        using Distance = PathCostOf<G>;
+        using Request = Impl::RelaxRequest<Distance>;
+        using RequestBuffers = std::vector<std::vector<Request>>;
+
+        constexpr std::size_t chunk_size = 64;
+        const auto node_count = arg.size();
+
+        if (source < 0 or static_cast<std::size_t>(source) >= node_count) {
+            return {};
+        }
+
+        const auto node_count_n = static_cast<int>(node_count);
+        const auto worker_count = std::max(thread_count, 1U);
+        Distance max_cost {};
+        std::size_t edge_count = 0;
+
+        for (auto node = 0; node < node_count_n; node++) {
+            for (const auto& [cost, adj_index] : arg.neighbors(node)) {
+                max_cost = std::max(max_cost, static_cast<Distance>(cost));
+                ++edge_count;
+            }
+        }
+
+        if (not (delta > Distance {})) {
+            const auto average_degree = std::max<std::size_t>(edge_count / node_count, 1);
+
+            delta = std::max(static_cast<Distance>(max_cost / static_cast<Distance>(average_degree)), static_cast<Distance>(1));
+        }
+
+        /// NOTE: live tentative distances never span more than `max_cost / delta + 1` buckets past the current one, so buckets are reused cyclically. A `delta` below `max_cost / node_count` only adds empty buckets, and the ring is capped at `Impl::max_delta_buckets`, so `delta` is raised until `max_cost / delta + 2` fits both.
+        const auto bucket_span = std::min(node_count, Impl::max_delta_buckets - 2);
+
+        if constexpr (std::is_floating_point_v<Distance>) {
+            delta = std::max(delta, static_cast<Distance>(max_cost / static_cast<Distance>(bucket_span)));
+        } else {
+            const auto bucket_span_d = static_cast<Distance>(bucket_span);
+
+            delta = std::max(delta, static_cast<Distance>(max_cost / bucket_span_d + ((max_cost % bucket_span_d != Distance {}) ? 1 : 0)));
+        }
+
+        const auto bucket_count = static_cast<std::size_t>(max_cost / delta) + 2;
+
+        auto bucketOf = [delta](Distance distance) noexcept {
+            if constexpr (std::is_floating_point_v<Distance>) {
+                return static_cast<std::size_t>(std::floor(distance / delta));
+            } else {
+                return static_cast<std::size_t>(distance / delta);
+            }
+        };
+
+        PathsResult<Distance> result {
+            .distances = std::vector<Distance>(node_count, unreachable_cost<Distance>),
+            .parents = std::vector<int>(node_count, no_node)
+        };
+
+        /// NOTE: `owned_buckets[worker][slot]` holds nodes the worker owns that were pushed into that cyclic bucket slot.
+        std::vector<std::vector<std::vector<int>>> owned_buckets (worker_count, std::vector<std::vector<int>>(bucket_count));
+        /// NOTE: `requests[scanner][owner]` holds requests emitted by `scanner` for nodes owned by `owner`.
+        std::vector<RequestBuffers> requests (worker_count, RequestBuffers(worker_count));
+        Containers::Bitset::DynamicBitset in_frontier (node_count);
+        std::vector<int> frontier {source};
+        std::vector<int> settled {source};
+        std::atomic<std::size_t> frontier_cursor {0};
+        std::size_t current_bucket = 0;
+        auto heavy_pass = false;
+        auto done = false;
+
+        result.distances[source] = Distance {};
+        result.parents[source] = no_node;
+
+        /// NOTE: runs on one worker after every owner applied its requests. It picks the next frontier: the refilled current bucket, then the heavy pass over settled nodes, then the next non-empty bucket.
+        auto advance = [&]() noexcept {
+            auto gatherBucket = [&](std::size_t bucket) {
+                frontier.clear();
+
+                for (auto& worker_buckets : owned_buckets) {
+                    auto& slot_nodes = worker_buckets[bucket % bucket_count];
+
+                    for (const auto node : slot_nodes) {
+                        if (bucketOf(result.distances[node]) == bucket and not in_frontier.testAndSet(node)) {
+                            frontier.emplace_back(node);
+                        }
+                    }
+
+                    slot_nodes.clear();
+                }
+
+                for (const auto node : frontier) {
+                    in_frontier.reset(node);
+                }
+            };
+
+            frontier_cursor.store(0, std::memory_order_relaxed);
+
+            if (not heavy_pass) {
+                gatherBucket(current_bucket);
+
+                if (not frontier.empty()) {
+                    settled.insert(settled.end(), frontier.cbegin(), frontier.cend());
+                    return;
+                }
+
+                heavy_pass = true;
+                std::swap(frontier, settled);
+                settled.clear();
+
+                return;
+            }
+
+            heavy_pass = false;
+
+            for (std::size_t step = 1; step <= bucket_count; step++) {
+                gatherBucket(current_bucket + step);
+
+                if (not frontier.empty()) {
+                    current_bucket += step;
+                    settled.assign(frontier.cbegin(), frontier.cend());
+                    return;
+                }
+            }
+
+            done = true;
+        };
+
+        std::barrier scan_sync (static_cast<std::ptrdiff_t>(worker_count));
+        std::barrier apply_sync (static_cast<std::ptrdiff_t>(worker_count), advance);
+
+        auto relaxBuckets = [&](unsigned int worker_id) {
+            auto& scanner_requests = requests[worker_id];
+
+            while (not done) {
+                for (auto chunk_begin = frontier_cursor.fetch_add(chunk_size, std::memory_order_relaxed); chunk_begin < frontier.size(); chunk_begin = frontier_cursor.fetch_add(chunk_size, std::memory_order_relaxed)) {
+                    const auto chunk_end = std::min(chunk_begin + chunk_size, frontier.size());
+
+                    for (auto frontier_idx = chunk_begin; frontier_idx < chunk_end; frontier_idx++) {
+                        const auto temp = frontier[frontier_idx];
+                        const auto temp_distance = result.distances[temp];
+
+                        for (const auto& [cost, adj_index] : arg.neighbors(temp)) {
+                            const auto edge_cost = static_cast<Distance>(cost);
+
+                            if ((edge_cost > delta) != heavy_pass) {
+                                continue;
+                            }
+
+                            if (const auto via_temp = temp_distance + edge_cost; via_temp < result.distances[adj_index]) {
+                                scanner_requests[static_cast<unsigned int>(adj_index) % worker_count].emplace_back(Request {via_temp, adj_index, temp});
+                            }
+                        }
+                    }
+                }
+
+                scan_sync.arrive_and_wait();
+
+                for (auto& scanner_buffers : requests) {
+                    for (const auto& [distance, node, parent] : scanner_buffers[worker_id]) {
+                        if (distance < result.distances[node]) {
+                            result.distances[node] = distance;
+                            result.parents[node] = parent;
+                            owned_buckets[worker_id][bucketOf(distance) % bucket_count].emplace_back(node);
+                        }
+                    }
+
+                    scanner_buffers[worker_id].clear();
+                }
+
+                apply_sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(worker_count - 1);
+
+        for (auto worker_id = 1U; worker_id < worker_count; worker_id++) {
+            workers.emplace_back(relaxBuckets, worker_id);
+        }
+
+        relaxBuckets(0);
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Describes an A* heuristic: `fn(item, goal_item)` estimates the remaining cost from a node to the goal. It must never overestimate that cost, or the returned path may not be the shortest.
+     * 
+     * @tparam Fn 
+     * @tparam NodeItem 
+     * @tparam Distance 
+     */
+    template <typename Fn, typename NodeItem, typename Distance>
+    concept HeuristicForItemKind = requires(Fn arg, const NodeItem& item, const NodeItem& goal) {
+        {arg(item, goal)} -> std::convertible_to<Distance>;
+    };
+
+    /**
+     * @brief Reusable search state for point-to-point queries (`searchAStar`, `searchBidirectionalDijkstra`, `searchBidirectionalBFS`), with one forward & one backward side. Per-node entries are only trusted when their stamp matches the current query's generation, so starting a query is O(1) instead of an O(n) clear. Buffers grow to the largest graph seen and are then reused, so repeated queries do not allocate.
+     * 
+     * @tparam Distance path cost type, e.g. `PathCostOf<G>` for weighted searches or `int` for hop counts
+     */
+    template <typename Distance>
+    class PathWorkspace {
+    public:
+        static constexpr int forward_side = 0;
+        static constexpr int backward_side = 1;
+
+    private:
+        struct Side {
+            std::vector<Distance> distances;
+            std::vector<int> parents;
+            std::vector<std::uint32_t> stamps;
+            Containers::Heaps::IndexedDaryHeap<Distance, 4> frontier;
+            std::vector<int> queue;
+        };
+
+        Side m_sides[2];
+        std::uint32_t m_generation;
+        int m_source;
+        int m_target;
+        int m_meeting;
+
+    public:
+        PathWorkspace()
+        : m_sides {}, m_generation {0}, m_source {no_node}, m_target {no_node}, m_meeting {no_node} {}
+
+        explicit PathWorkspace(std::size_t node_count)
+        : PathWorkspace {} {
+            reserve(node_count);
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return m_sides[forward_side].stamps.size();
+        }
+
+        void reserve(std::size_t node_count) {
+            if (node_count <= capacity()) {
+                return;
+            }
+
+            for (auto& side : m_sides) {
+                side.distances.resize(node_count);
+                side.parents.resize(node_count);
+                side.stamps.resize(node_count, 0);
+                side.frontier = Containers::Heaps::IndexedDaryHeap<Distance, 4> (node_count);
+                side.queue.reserve(node_count);
+            }
+        }
+
+        /**
+         * @brief Starts a query over nodes `[0, node_count)`, forgetting every reached node of the previous one.
+         */
+        void beginQuery(std::size_t node_count, int source, int target) {
+            reserve(node_count);
+
+            for (auto& side : m_sides) {
+                side.frontier.clear();
+                side.queue.clear();
+            }
+
+            /// NOTE: on the rare generation wrap-around, stale stamps could alias the new generation, so they are wiped once.
+            if (++m_generation == 0) {
+                for (auto& side : m_sides) {
+                    std::fill(side.stamps.begin(), side.stamps.end(), 0);
+                }
+
+                m_generation = 1;
+            }
+
+            m_source = source;
+            m_target = target;
+            m_meeting = no_node;
+        }
+
+        [[nodiscard]] bool reached(int side, int node) const noexcept {
+            return m_sides[side].stamps[node] == m_generation;
+        }
+
+        [[nodiscard]] Distance distanceOf(int side, int node) const noexcept {
+            return reached(side, node) ? m_sides[side].distances[node] : unreachable_cost<Distance>;
+        }
+
+        [[nodiscard]] int parentOf(int side, int node) const noexcept {
+            return reached(side, node) ? m_sides[side].parents[node] : no_node;
+        }
+
+        void reach(int side, int node, Distance distance, int parent) noexcept {
+            m_sides[side].stamps[node] = m_generation;
+            m_sides[side].distances[node] = distance;
+            m_sides[side].parents[node] = parent;
+        }
+
+        [[nodiscard]] Containers::Heaps::IndexedDaryHeap<Distance, 4>& frontier(int side) & noexcept {
+            return m_sides[side].frontier;
+        }
+
+        [[nodiscard]] std::vector<int>& queue(int side) & noexcept {
+            return m_sides[side].queue;
+        }
+
+        void meetAt(int node) noexcept {
+            m_meeting = node;
+        }
+
+        /**
+         * @brief Writes the node indices of the last query's path from source to target into `path`, reusing its capacity. Leaves `path` empty when the target was not reached.
+         */
+        void pathInto(std::vector<int>& path) const {
+            path.clear();
+
+            if (m_meeting == no_node) {
+                return;
+            }
+
+            for (auto node = m_meeting; node != no_node; node = parentOf(forward_side, node)) {
+                path.emplace_back(node);
+            }
+
+            std::reverse(path.begin(), path.end());
+
+            for (auto node = parentOf(backward_side, m_meeting); node != no_node; node = parentOf(backward_side, node)) {
+                path.emplace_back(node);
+            }
+        }
+    };
+
+    /**
+     * @brief A* search from `source` to `target` over non-negative edge costs. Nodes are queued by `distance + heuristic(item, target item)`, and the search stops as soon as the target is popped. With a zero heuristic this is a Dijkstra search that stops early. Inconsistent but admissible heuristics are handled by reopening nodes whose distance improves.
+     * 
+     * @param arg any `WeightedGraphKind`
+     * @param source index of the start node
+     * @param target index of the goal node
+     * @param heuristic admissible remaining-cost estimate, see `HeuristicForItemKind`
+     * @param workspace reusable state. Call `workspace.pathInto(path)` afterwards for the route
+     * @return PathCostOf<G> the shortest distance, or `unreachable_cost` if there is no path
+     */
+    template <typename G, typename Fn> requires (Meta::Graphs::WeightedGraphKind<G> and HeuristicForItemKind<Fn, Meta::Graphs::GraphItemOf<G>, PathCostOf<G>>)
+    [[nodiscard]] auto searchAStar(const G& arg, int source, int target, Fn&& heuristic, PathWorkspace<PathCostOf<G>>& workspace) -> PathCostOf<G> {
+        using Distance = PathCostOf<G>;
+        using Workspace = PathWorkspace<Distance>;
+
+        const auto node_count = arg.size();
+
+        if (source < 0 or target < 0 or static_cast<std::size_t>(source) >= node_count or static_cast<std::size_t>(target) >= node_count) {
+            return unreachable_cost<Distance>;
+        }
+
+        const auto& goal = arg.itemAt(target);
+        auto& pending = workspace.frontier(Workspace::forward_side);
+
+        workspace.beginQuery(node_count, source, target);
+        workspace.reach(Workspace::forward_side, source, Distance {}, no_node);
+        pending.pushOrDecrease(source, static_cast<Distance>(heuristic(arg.itemAt(source), goal)));
+
+        while (not pending.empty()) {
+            const auto temp = pending.pop().id;
+            const auto temp_distance = workspace.distanceOf(Workspace::forward_side, temp);
+
+            if (temp == target) {
+                workspace.meetAt(target);
+
+                return temp_distance;
+            }
+
+            for (const auto& [cost, adj_index] : arg.neighbors(temp)) {
+                if (const auto via_temp = temp_distance + static_cast<Distance>(cost); via_temp < workspace.distanceOf(Workspace::forward_side, adj_index)) {
+                    workspace.reach(Workspace::forward_side, adj_index, via_temp, temp);
+                    pending.pushOrDecrease(adj_index, via_temp + static_cast<Distance>(heuristic(arg.itemAt(adj_index), goal)));
+                }
+            }
+        }
+
+        return unreachable_cost<Distance>;
+    }
+
+    /**
+     * @brief Bidirectional Dijkstra from `source` to `target` over non-negative edge costs. A forward search over `arg` and a backward search over `reverse` take turns, each time expanding whichever frontier has the smaller minimum key. Every edge that reaches a node already seen by the other side may improve the best meeting cost `mu`. The search stops once the two minimum keys together reach `mu`, because no unexplored path can then be shorter.
+     * 
+     * @param arg any `WeightedGraphKind`
+     * @param reverse the transposed graph, e.g. `transposeOf(arg)`, or `arg` itself when every edge is `two_way`
+     * @param source index of the start node
+     * @param target index of the goal node
+     * @param workspace reusable state. Call `workspace.pathInto(path)` afterwards for the route
+     * @return PathCostOf<G> the shortest distance, or `unreachable_cost` if there is no path
+     */
+    template <typename G, typename R> requires (Meta::Graphs::WeightedGraphKind<G> and Meta::Graphs::WeightedGraphKind<R>)
+    [[nodiscard]] auto searchBidirectionalDijkstra(const G& arg, const R& reverse, int source, int target, PathWorkspace<PathCostOf<G>>& workspace) -> PathCostOf<G> {
+        using Distance = PathCostOf<G>;
+        using Workspace = PathWorkspace<Distance>;
+
+        const auto node_count = arg.size();
+
+        if (source < 0 or target < 0 or static_cast<std::size_t>(source) >= node_count or static_cast<std::size_t>(target) >= node_count) {
+            return unreachable_cost<Distance>;
+        }
+
+        auto best_distance = unreachable_cost<Distance>;
+
+        workspace.beginQuery(node_count, source, target);
+        workspace.reach(Workspace::forward_side, source, Distance {}, no_node);
+        workspace.reach(Workspace::backward_side, target, Distance {}, no_node);
+        workspace.frontier(Workspace::forward_side).pushOrDecrease(source, Distance {});
+        workspace.frontier(Workspace::backward_side).pushOrDecrease(target, Distance {});
+
+        if (source == target) {
+            workspace.meetAt(source);
+
+            return Distance {};
+        }
+
+        auto expand = [&](int side, const auto& graph) {
+            const auto other_side = 1 - side;
+            const auto temp = workspace.frontier(side).pop().id;
+            const auto temp_distance = workspace.distanceOf(side, temp);
+
+            for (const auto& [cost, adj_index] : graph.neighbors(temp)) {
+                const auto via_temp = temp_distance + static_cast<Distance>(cost);
+
+                if (via_temp < workspace.distanceOf(side, adj_index)) {
+                    workspace.reach(side, adj_index, via_temp, temp);
+                    workspace.frontier(side).pushOrDecrease(adj_index, via_temp);
+                }
+
+                if (workspace.reached(other_side, adj_index)) {
+                    if (const auto through = workspace.distanceOf(side, adj_index) + workspace.distanceOf(other_side, adj_index); through < best_distance) {
+                        best_distance = through;
+                        workspace.meetAt(adj_index);
+                    }
+                }
+            }
+        };
+
+        auto& forward_frontier = workspace.frontier(Workspace::forward_side);
+        auto& backward_frontier = workspace.frontier(Workspace::backward_side);
+
+        while (not forward_frontier.empty() and not backward_frontier.empty()) {
+            const auto forward_key = forward_frontier.top().key;
+            const auto backward_key = backward_frontier.top().key;
+
+            if (best_distance != unreachable_cost<Distance> and forward_key + backward_key >= best_distance) {
+                break;
+            }
+
+            if (forward_key <= backward_key) {
+                expand(Workspace::forward_side, arg);
+            } else {
+                expand(Workspace::backward_side, reverse);
+            }
+        }
+
+        return best_distance;
+    }
+
+    /**
+     * @brief Bidirectional breadth-first search from `source` to `target`, ignoring edge costs. Each round expands one whole level of the smaller frontier, and the first level that touches the other side's reached set fixes the fewest-hops distance.
+     * 
+     * @param arg any `IndexedGraphKind`
+     * @param reverse the transposed graph, or `arg` itself when every edge is `two_way`
+     * @param source index of the start node
+     * @param target index of the goal node
+     * @param workspace reusable state. Call `workspace.pathInto(path)` afterwards for the route
+     * @return int the number of hops, or `no_node` if there is no path
+     */
+    template <typename G, typename R> requires (Meta::Graphs::IndexedGraphKind<G> and Meta::Graphs::IndexedGraphKind<R>)
+    [[nodiscard]] int searchBidirectionalBFS(const G& arg, const R& reverse, int source, int target, PathWorkspace<int>& workspace) {
+        using Workspace = PathWorkspace<int>;
+
+        const auto node_count = arg.size();
+
+        if (source < 0 or target < 0 or static_cast<std::size_t>(source) >= node_count or static_cast<std::size_t>(target) >= node_count) {
+            return no_node;
+        }
+
+        workspace.beginQuery(node_count, source, target);
+        workspace.reach(Workspace::forward_side, source, 0, no_node);
+        workspace.reach(Workspace::backward_side, target, 0, no_node);
+
+        if (source == target) {
+            workspace.meetAt(source);
+
+            return 0;
+        }
+
+        workspace.queue(Workspace::forward_side).emplace_back(source);
+        workspace.queue(Workspace::backward_side).emplace_back(target);
+
+        /// NOTE: each queue holds one level. Expanding appends the next level behind it, and the expanded level is then dropped from the front.
+        auto expandLevel = [&](int side, const auto& graph) {
+            const auto other_side = 1 - side;
+            auto& level = workspace.queue(side);
+            const auto level_end = level.size();
+            auto best_hops = unreachable_cost<int>;
+
+            for (std::size_t slot = 0; slot < level_end; slot++) {
+                const auto temp = level[slot];
+                const auto next_hops = workspace.distanceOf(side, temp) + 1;
+
+                for (const auto& edge : graph.neighbors(temp)) {
+                    const auto next = Containers::Graph::destinationOf(edge);
+
+                    if (workspace.reached(side, next)) {
+                        continue;
+                    }
+
+                    workspace.reach(side, next, next_hops, temp);
+                    level.emplace_back(next);
+
+                    if (workspace.reached(other_side, next) and next_hops + workspace.distanceOf(other_side, next) < best_hops) {
+                        best_hops = next_hops + workspace.distanceOf(other_side, next);
+                        workspace.meetAt(next);
+                    }
+                }
+            }
+
+            level.erase(level.begin(), level.begin() + static_cast<std::ptrdiff_t>(level_end));
+
+            return best_hops;
+        };
+
+        while (not workspace.queue(Workspace::forward_side).empty() and not workspace.queue(Workspace::backward_side).empty()) {
+            const auto forward_smaller = workspace.queue(Workspace::forward_side).size() <= workspace.queue(Workspace::backward_side).size();
+            const auto hops = forward_smaller
+                ? expandLevel(Workspace::forward_side, arg)
+                : expandLevel(Workspace::backward_side, reverse);
+
+            if (hops != unreachable_cost<int>) {
+                return hops;
+            }
+        }
+
+        return no_node;
+    }
+}
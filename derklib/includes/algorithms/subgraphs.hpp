@@ -0,0 +1,261 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <vector>
+#include "containers/graph.hpp"
+#include "meta/graphs.hpp"
+
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace DerkLib::Algorithms::Graph {
+    /**
+     * @brief Describes a graph that exposes each node's neighbors as one contiguous run of destination indices, e.g. `CsrGraph` or `MappedGraph`.
+     * 
+     * @tparam G 
+     */
+    template <typename G>
+    concept ContiguousGraphKind = Meta::Graphs::IndexedGraphKind<G> and requires (const G& arg, int index) {
+        {arg.targetsOf(index)} -> std::convertible_to<std::span<const int>>;
+    };
+
+    struct TriangleCounts {
+        std::vector<long long> per_node;
+        long long total;
+    };
+
+    namespace Impl {
+        [[nodiscard]] inline long long countCommonScalar(const int* lhs, std::size_t lhs_size, const int* rhs, std::size_t rhs_size) noexcept {
+            std::size_t lhs_pos = 0;
+            std::size_t rhs_pos = 0;
+            long long common = 0;
+
+            while (lhs_pos < lhs_size and rhs_pos < rhs_size) {
+                if (lhs[lhs_pos] < rhs[rhs_pos]) {
+                    ++lhs_pos;
+                } else if (rhs[rhs_pos] < lhs[lhs_pos]) {
+                    ++rhs_pos;
+                } else {
+                    ++common;
+                    ++lhs_pos;
+                    ++rhs_pos;
+                }
+            }
+
+            return common;
+        }
+
+#if defined(__x86_64__) or defined(__i386__)
+        /// NOTE: block merge after Schlegel et al. & Lemire et al.: each 4-wide block of `lhs` is compared with every rotation of the current `rhs` block, then the block with the smaller last element advances. Needs duplicate-free runs.
+        [[nodiscard]] __attribute__((target("sse2"))) inline long long countCommonSse2(const int* lhs, std::size_t lhs_size, const int* rhs, std::size_t rhs_size) noexcept {
+            std::size_t lhs_pos = 0;
+            std::size_t rhs_pos = 0;
+            long long common = 0;
+
+            while (lhs_pos + 4 <= lhs_size and rhs_pos + 4 <= rhs_size) {
+                const auto lhs_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + lhs_pos));
+                const auto rhs_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + rhs_pos));
+                auto matches = _mm_cmpeq_epi32(lhs_block, rhs_block);
+
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi32(lhs_block, _mm_shuffle_epi32(rhs_block, _MM_SHUFFLE(0, 3, 2, 1))));
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi32(lhs_block, _mm_shuffle_epi32(rhs_block, _MM_SHUFFLE(1, 0, 3, 2))));
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi32(lhs_block, _mm_shuffle_epi32(rhs_block, _MM_SHUFFLE(2, 1, 0, 3))));
+                common += __builtin_popcount(static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(matches))));
+
+                const auto lhs_last = lhs[lhs_pos + 3];
+                const auto rhs_last = rhs[rhs_pos + 3];
+
+                lhs_pos += (lhs_last <= rhs_last) ? 4 : 0;
+                rhs_pos += (rhs_last <= lhs_last) ? 4 : 0;
+            }
+
+            return common + countCommonScalar(lhs + lhs_pos, lhs_size - lhs_pos, rhs + rhs_pos, rhs_size - rhs_pos);
+        }
+
+        [[nodiscard]] __attribute__((target("avx2"))) inline long long countCommonAvx2(const int* lhs, std::size_t lhs_size, const int* rhs, std::size_t rhs_size) noexcept {
+            std::size_t lhs_pos = 0;
+            std::size_t rhs_pos = 0;
+            long long common = 0;
+            const auto rotate_by_one = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+
+            while (lhs_pos + 8 <= lhs_size and rhs_pos + 8 <= rhs_size) {
+                const auto lhs_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + lhs_pos));
+                auto rhs_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + rhs_pos));
+                auto matches = _mm256_cmpeq_epi32(lhs_block, rhs_block);
+
+                for (auto rotation = 1; rotation < 8; rotation++) {
+                    rhs_block = _mm256_permutevar8x32_epi32(rhs_block, rotate_by_one);
+                    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi32(lhs_block, rhs_block));
+                }
+
+                common += __builtin_popcount(static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(matches))));
+
+                const auto lhs_last = lhs[lhs_pos + 7];
+                const auto rhs_last = rhs[rhs_pos + 7];
+
+                lhs_pos += (lhs_last <= rhs_last) ? 8 : 0;
+                rhs_pos += (rhs_last <= lhs_last) ? 8 : 0;
+            }
+
+            return common + countCommonSse2(lhs + lhs_pos, lhs_size - lhs_pos, rhs + rhs_pos, rhs_size - rhs_pos);
+        }
+#endif
+
+        using CommonCounter = long long (*)(const int*, std::size_t, const int*, std::size_t) noexcept;
+
+        /**
+         * @brief Picks the widest intersection kernel the running CPU supports, once per process.
+         */
+        [[nodiscard]] inline CommonCounter commonCounter() noexcept {
+#if defined(__x86_64__) or defined(__i386__)
+            static const CommonCounter kernel = __builtin_cpu_supports("avx2") ? &countCommonAvx2 : &countCommonSse2;
+
+            return kernel;
+#else
+            return &countCommonScalar;
+#endif
+        }
+
+        /**
+         * @brief Counts the values shared by two ascending, duplicate-free runs.
+         */
+        [[nodiscard]] inline long long countCommon(std::span<const int> lhs, std::span<const int> rhs) noexcept {
+            return commonCounter()(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+        }
+    }
+
+    /**
+     * @brief Counts the triangles through every node of an undirected graph. Each node `u` sums the sorted-run intersections `|N(u) ∩ N(v)|` over its neighbors `v`, which counts each of its triangles twice. The intersections use a SIMD block merge (AVX2 or SSE2, picked at runtime, with a scalar fallback). Each node's count is written only by the worker that claimed it, so `thread_count` workers (counting the calling thread) take node chunks from a shared cursor without further synchronization.
+     * 
+     * @param arg a symmetric graph with ascending, duplicate-free neighbor runs and no self-loops, e.g. from `buildCsrGraph` with `direction = two_way` & `deduplicate = true`
+     * @param thread_count 
+     * @return TriangleCounts per-node counts, plus the total number of distinct triangles
+     */
+    template <typename G> requires (ContiguousGraphKind<G>)
+    [[nodiscard]] TriangleCounts countTriangles(const G& arg, unsigned int thread_count = 1) {
+        constexpr std::size_t chunk_size = 64;
+        const auto node_count = arg.size();
+        const auto worker_count = std::max(thread_count, 1U);
+        std::atomic<std::size_t> node_cursor {0};
+        TriangleCounts result {
+            .per_node = std::vector<long long>(node_count, 0),
+            .total = 0
+        };
+
+        auto countChunks = [&]() noexcept {
+            const auto count_common = Impl::commonCounter();
+
+            for (auto chunk_begin = node_cursor.fetch_add(chunk_size, std::memory_order_relaxed); chunk_begin < node_count; chunk_begin = node_cursor.fetch_add(chunk_size, std::memory_order_relaxed)) {
+                const auto chunk_end = std::min(chunk_begin + chunk_size, node_count);
+
+                for (auto node = static_cast<int>(chunk_begin); node < static_cast<int>(chunk_end); node++) {
+                    const std::span<const int> node_run = arg.targetsOf(node);
+                    long long twice_triangles = 0;
+
+                    for (const auto adj_index : node_run) {
+                        const std::span<const int> adj_run = arg.targetsOf(adj_index);
+
+                        twice_triangles += count_common(node_run.data(), node_run.size(), adj_run.data(), adj_run.size());
+                    }
+
+                    result.per_node[node] = twice_triangles / 2;
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(worker_count - 1);
+
+        for (auto worker_id = 1U; worker_id < worker_count; worker_id++) {
+            workers.emplace_back(countChunks);
+        }
+
+        countChunks();
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        for (const auto node_triangles : result.per_node) {
+            result.total += node_triangles;
+        }
+
+        result.total /= 3;
+
+        return result;
+    }
+
+    /**
+     * @brief Computes every node's core number, the largest `k` such that the node belongs to a subgraph where all nodes have degree `>= k`, in O(V + E) with the Batagelj-Zaversnik bucket peeling. Nodes sit in flat arrays sorted by current degree. Peeling a node decrements each higher-degree neighbor, swapping that neighbor to the front of its degree bucket, so no heap or per-node allocation is needed.
+     * 
+     * @param arg an undirected graph without self-loops or parallel edges, whose `neighbors` may be unsorted
+     * @return std::vector<int> core number per node
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::vector<int> decomposeCores(const G& arg) {
+        const auto node_count = static_cast<int>(arg.size());
+        std::vector<int> degrees (node_count);
+        std::vector<int> positions (node_count);
+        std::vector<int> sorted_nodes (node_count);
+        auto max_degree = 0;
+
+        for (auto node = 0; node < node_count; node++) {
+            degrees[node] = static_cast<int>(std::ranges::distance(arg.neighbors(node)));
+            max_degree = std::max(max_degree, degrees[node]);
+        }
+
+        /// NOTE: `bucket_starts[d]` is the first slot of `sorted_nodes` holding a node of current degree `d`.
+        std::vector<int> bucket_starts (max_degree + 2, 0);
+
+        for (const auto degree : degrees) {
+            ++bucket_starts[degree + 1];
+        }
+
+        for (auto degree = 0; degree <= max_degree; degree++) {
+            bucket_starts[degree + 1] += bucket_starts[degree];
+        }
+
+        {
+            std::vector<int> cursors (bucket_starts.cbegin(), bucket_starts.cend() - 1);
+
+            for (auto node = 0; node < node_count; node++) {
+                positions[node] = cursors[degrees[node]]++;
+                sorted_nodes[positions[node]] = node;
+            }
+        }
+
+        for (auto slot = 0; slot < node_count; slot++) {
+            const auto temp = sorted_nodes[slot];
+
+            for (const auto& edge : arg.neighbors(temp)) {
+                const auto adj_index = Containers::Graph::destinationOf(edge);
+
+                if (degrees[adj_index] <= degrees[temp]) {
+                    continue;
+                }
+
+                const auto adj_degree = degrees[adj_index];
+                const auto bucket_front = bucket_starts[adj_degree];
+                const auto front_node = sorted_nodes[bucket_front];
+
+                if (front_node != adj_index) {
+                    std::swap(sorted_nodes[positions[adj_index]], sorted_nodes[bucket_front]);
+                    std::swap(positions[adj_index], positions[front_node]);
+                }
+
+                ++bucket_starts[adj_degree];
+                --degrees[adj_index];
+            }
+        }
+
+        return degrees;
+    }
+}
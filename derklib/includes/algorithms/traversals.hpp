@@ -1,11 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <iterator>
+#include <ranges>
 #include <type_traits>
-// #include <set> /// NOTE: add DFS later using a stack frontier.
-#include <queue>
-// #include <stack>
+#include <thread>
+#include <utility>
 #include <vector>
+#if __has_include(<generator>)
+#include <generator>
+#endif
+#include "containers/bitset.hpp"
 #include "containers/graph.hpp"
+#include "meta/graphs.hpp"
 
 namespace DerkLib::Algorithms::Graph {
     using PathPolicy = DerkLib::Containers::Graph::PathPolicy;
@@ -15,30 +24,439 @@ namespace DerkLib::Algorithms::Graph {
         {arg(item)};
     };
 
-    template <typename Fn, template <PathPolicy, typename> typename Graph, PathPolicy P, typename Item> requires (CallableForItemKind<Fn, Item>)
-    [[nodiscard]] auto traverseBFS(const Graph<P, Item>& arg, Fn&& fn) noexcept -> std::vector<std::remove_reference_t<decltype(fn(arg.first()))>> {
+    /// NOTE: marks a missing parent or an unreached level in search results.
+    constexpr int no_node = -1;
+
+    /**
+     * @brief Result of an index-based breadth-first search. `order` lists reached nodes in visit order, while `levels` & `parents` are indexed by node, holding `no_node` for unreached nodes (and as the source's parent).
+     */
+    struct BfsResult {
+        std::vector<int> order;
+        std::vector<int> levels;
+        std::vector<int> parents;
+    };
+
+    /**
+     * @brief Switching thresholds for `searchBFSDirectionOpt`, per Beamer et al. Top-down hands off to bottom-up once the frontier's out-edges exceed `unexplored_edges / alpha`, and bottom-up hands back once the frontier shrinks below `node_count / beta` nodes.
+     */
+    struct DirectionOptConfig {
+        int alpha = 14;
+        int beta = 24;
+    };
+
+    /**
+     * @brief Visits nodes breadth-first from the graph's first node, collecting `fn(item)` per visit. Works over any `IndexedGraphKind` (`Graph`, `CsrGraph`, ...): each node is visited once, tracked by a packed bitset, and the frontier is a flat vector of node indices.
+     */
+    template <typename Fn, typename G> requires (Meta::Graphs::IndexedGraphKind<G> and CallableForItemKind<Fn, Meta::Graphs::GraphItemOf<G>>)
+    [[nodiscard]] auto traverseBFS(const G& arg, Fn&& fn) noexcept -> std::vector<std::remove_reference_t<decltype(fn(arg.first()))>> {
         using ResultType = std::remove_reference_t<decltype(fn(arg.first()))>;
 
         if (arg.size() == 0) {
             return {};
         }
 
-        std::queue<Item> frontier;
+        Containers::Bitset::DynamicBitset visited (arg.size());
+        std::vector<int> frontier;
         std::vector<ResultType> results;
 
-        frontier.push(arg.first());
+        frontier.reserve(arg.size());
+        frontier.emplace_back(0);
+        visited.set(0);
 
-        while (not frontier.empty()) {
-            auto temp = frontier.front();
-            frontier.pop();
+        for (std::size_t frontier_head = 0; frontier_head < frontier.size(); frontier_head++) {
+            const auto temp = frontier[frontier_head];
 
-            results.emplace_back(fn(temp));
+            results.emplace_back(fn(arg.itemAt(temp)));
 
-            for (const auto& adj_ptr : arg.neighborsOf(temp)) {
-                frontier.push(*adj_ptr);
+            for (const auto& adj_edge : arg.neighbors(temp)) {
+                if (const auto adj_index = Containers::Graph::destinationOf(adj_edge); not visited.testAndSet(adj_index)) {
+                    frontier.emplace_back(adj_index);
+                }
             }
         }
 
         return results;
     }
+
+    namespace Impl {
+        /**
+         * @brief One level of an explicit-stack DFS: the node being explored & its remaining neighbor range, so deep graphs never recurse on the call stack.
+         */
+        template <typename G>
+        struct DfsFrame {
+            using NeighborRange = decltype(std::declval<const G&>().neighbors(0));
+
+            int node;
+            std::ranges::iterator_t<NeighborRange> next;
+            std::ranges::sentinel_t<NeighborRange> end;
+        };
+
+        template <typename G>
+        [[nodiscard]] DfsFrame<G> dfsFrameOf(const G& arg, int node) noexcept {
+            auto adj_edges = arg.neighbors(node);
+
+            return {node, std::ranges::begin(adj_edges), std::ranges::end(adj_edges)};
+        }
+    }
+
+    /**
+     * @brief Visits nodes depth-first from the graph's first node, collecting `fn(item)` per visit in preorder. The order matches a recursive DFS, but it uses an explicit stack of neighbor iterators, so path-shaped graphs with millions of nodes cannot overflow the call stack.
+     */
+    template <typename Fn, typename G> requires (Meta::Graphs::IndexedGraphKind<G> and CallableForItemKind<Fn, Meta::Graphs::GraphItemOf<G>>)
+    [[nodiscard]] auto traverseDFS(const G& arg, Fn&& fn) noexcept -> std::vector<std::remove_reference_t<decltype(fn(arg.first()))>> {
+        using ResultType = std::remove_reference_t<decltype(fn(arg.first()))>;
+
+        if (arg.size() == 0) {
+            return {};
+        }
+
+        Containers::Bitset::DynamicBitset visited (arg.size());
+        std::vector<Impl::DfsFrame<G>> frames;
+        std::vector<ResultType> results;
+
+        visited.set(0);
+        results.emplace_back(fn(arg.itemAt(0)));
+        frames.emplace_back(Impl::dfsFrameOf(arg, 0));
+
+        while (not frames.empty()) {
+            auto& top = frames.back();
+
+            if (top.next == top.end) {
+                frames.pop_back();
+                continue;
+            }
+
+            if (const auto adj_index = Containers::Graph::destinationOf(*top.next++); not visited.testAndSet(adj_index)) {
+                results.emplace_back(fn(arg.itemAt(adj_index)));
+                frames.emplace_back(Impl::dfsFrameOf(arg, adj_index));
+            }
+        }
+
+        return results;
+    }
+
+#if defined(__cpp_lib_generator)
+    /**
+     * @brief Lazily yields node indices breadth-first from `source`. A node's neighbors are only expanded once the caller asks for more, so stopping early (`std::ranges::find`, `std::views::take`, a `break`) skips the rest of the search. `arg` must outlive the generator and stay unmodified while it runs.
+     * 
+     * @param arg 
+     * @param source index of the start node. Nothing is yielded when it is out of range
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::generator<int> lazyBFS(const G& arg, int source) {
+        if (source < 0 or static_cast<std::size_t>(source) >= arg.size()) {
+            co_return;
+        }
+
+        Containers::Bitset::DynamicBitset visited (arg.size());
+        std::vector<int> frontier;
+
+        frontier.emplace_back(source);
+        visited.set(source);
+
+        for (std::size_t frontier_head = 0; frontier_head < frontier.size(); frontier_head++) {
+            const auto temp = frontier[frontier_head];
+
+            co_yield temp;
+
+            for (const auto& adj_edge : arg.neighbors(temp)) {
+                if (const auto adj_index = Containers::Graph::destinationOf(adj_edge); not visited.testAndSet(adj_index)) {
+                    frontier.emplace_back(adj_index);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Lazily yields node indices depth-first (preorder) from `source`, with the same explicit stack as `traverseDFS`. A node's neighbors are walked only as the caller pulls more values. `arg` must outlive the generator and stay unmodified while it runs.
+     * 
+     * @param arg 
+     * @param source index of the start node. Nothing is yielded when it is out of range
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] std::generator<int> lazyDFS(const G& arg, int source) {
+        if (source < 0 or static_cast<std::size_t>(source) >= arg.size()) {
+            co_return;
+        }
+
+        Containers::Bitset::DynamicBitset visited (arg.size());
+        std::vector<Impl::DfsFrame<G>> frames;
+
+        visited.set(source);
+        co_yield source;
+        frames.emplace_back(Impl::dfsFrameOf(arg, source));
+
+        while (not frames.empty()) {
+            auto& top = frames.back();
+
+            if (top.next == top.end) {
+                frames.pop_back();
+                continue;
+            }
+
+            if (const auto adj_index = Containers::Graph::destinationOf(*top.next++); not visited.testAndSet(adj_index)) {
+                co_yield adj_index;
+                frames.emplace_back(Impl::dfsFrameOf(arg, adj_index));
+            }
+        }
+    }
+#endif
+
+    /**
+     * @brief Index-based BFS from `source` that records visit order, per-node levels & BFS-tree parents. Runs in O(V + E) time and its frontier never exceeds V entries, even on cyclic graphs.
+     * 
+     * @param arg 
+     * @param source index of the start node
+     * @return BfsResult (empty if `source` is out of range)
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] BfsResult searchBFS(const G& arg, int source) {
+        const auto node_count = arg.size();
+
+        if (source < 0 or static_cast<std::size_t>(source) >= node_count) {
+            return {};
+        }
+
+        Containers::Bitset::DynamicBitset visited (node_count);
+        BfsResult result {
+            .order = {},
+            .levels = std::vector<int>(node_count, no_node),
+            .parents = std::vector<int>(node_count, no_node)
+        };
+
+        /// NOTE: `order` doubles as the FIFO frontier: everything after `frontier_head` is still waiting for expansion.
+        auto& frontier = result.order;
+
+        frontier.reserve(node_count);
+        frontier.emplace_back(source);
+        visited.set(source);
+        result.levels[source] = 0;
+
+        for (std::size_t frontier_head = 0; frontier_head < frontier.size(); frontier_head++) {
+            const auto temp = frontier[frontier_head];
+            const auto next_level = result.levels[temp] + 1;
+
+            for (const auto& adj_edge : arg.neighbors(temp)) {
+                if (const auto adj_index = Containers::Graph::destinationOf(adj_edge); not visited.testAndSet(adj_index)) {
+                    result.levels[adj_index] = next_level;
+                    result.parents[adj_index] = temp;
+                    frontier.emplace_back(adj_index);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Direction-optimizing BFS from `source`. Small frontiers expand top-down like `searchBFS`. Once the frontier's out-edges pass the `config.alpha` threshold, each level instead scans every unvisited node's in-neighbors in `reverse` and stops at the first one in the frontier. Levels match `searchBFS`; parents are valid BFS-tree parents, but may differ among equally short ones.
+     * 
+     * @param arg 
+     * @param reverse the transpose of `arg`, e.g. from `Containers::Graph::transposeOf`
+     * @param source index of the start node
+     * @param config switching thresholds
+     * @return BfsResult (empty if `source` is out of range)
+     */
+    template <typename G, typename R> requires (Meta::Graphs::IndexedGraphKind<G> and Meta::Graphs::IndexedGraphKind<R>)
+    [[nodiscard]] BfsResult searchBFSDirectionOpt(const G& arg, const R& reverse, int source, DirectionOptConfig config = {}) {
+        const auto node_count = arg.size();
+
+        if (source < 0 or static_cast<std::size_t>(source) >= node_count or reverse.size() != node_count) {
+            return {};
+        }
+
+        const auto node_count_n = static_cast<int>(node_count);
+        const auto alpha = std::max(config.alpha, 1);
+        const auto beta = std::max(config.beta, 1);
+        std::vector<int> out_degrees (node_count, 0);
+        long long unexplored_edges = 0;
+
+        for (auto node = 0; node < node_count_n; node++) {
+            out_degrees[node] = static_cast<int>(std::ranges::distance(arg.neighbors(node)));
+            unexplored_edges += out_degrees[node];
+        }
+
+        Containers::Bitset::DynamicBitset visited (node_count);
+        Containers::Bitset::DynamicBitset in_frontier (node_count);
+        std::vector<int> frontier {source};
+        std::vector<int> next_frontier;
+        BfsResult result {
+            .order = {source},
+            .levels = std::vector<int>(node_count, no_node),
+            .parents = std::vector<int>(node_count, no_node)
+        };
+
+        result.order.reserve(node_count);
+        visited.set(source);
+        result.levels[source] = 0;
+        unexplored_edges -= out_degrees[source];
+
+        auto bottom_up = false;
+        auto level = 0;
+
+        while (not frontier.empty()) {
+            long long frontier_edges = 0;
+
+            for (const auto node : frontier) {
+                frontier_edges += out_degrees[node];
+            }
+
+            if (not bottom_up and frontier_edges > unexplored_edges / alpha) {
+                bottom_up = true;
+            } else if (bottom_up and static_cast<long long>(frontier.size()) < node_count_n / beta) {
+                bottom_up = false;
+            }
+
+            next_frontier.clear();
+            ++level;
+
+            if (bottom_up) {
+                in_frontier.clear();
+
+                for (const auto node : frontier) {
+                    in_frontier.set(node);
+                }
+
+                for (auto node = 0; node < node_count_n; node++) {
+                    if (visited.test(node)) {
+                        continue;
+                    }
+
+                    for (const auto& rev_edge : reverse.neighbors(node)) {
+                        if (const auto parent = Containers::Graph::destinationOf(rev_edge); in_frontier.test(parent)) {
+                            result.parents[node] = parent;
+                            next_frontier.emplace_back(node);
+                            break;
+                        }
+                    }
+                }
+
+                /// NOTE: mark after the sweep so nodes found this level cannot act as parents within the same level.
+                for (const auto node : next_frontier) {
+                    visited.set(node);
+                }
+            } else {
+                for (const auto node : frontier) {
+                    for (const auto& adj_edge : arg.neighbors(node)) {
+                        if (const auto adj_index = Containers::Graph::destinationOf(adj_edge); not visited.testAndSet(adj_index)) {
+                            result.parents[adj_index] = node;
+                            next_frontier.emplace_back(adj_index);
+                        }
+                    }
+                }
+            }
+
+            for (const auto node : next_frontier) {
+                result.levels[node] = level;
+                unexplored_edges -= out_degrees[node];
+            }
+
+            result.order.insert(result.order.end(), next_frontier.cbegin(), next_frontier.cend());
+            std::swap(frontier, next_frontier);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Overload of `searchBFSDirectionOpt` that builds the reverse adjacency itself. Prefer passing a cached transpose when searching the same graph repeatedly.
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] BfsResult searchBFSDirectionOpt(const G& arg, int source, DirectionOptConfig config = {}) {
+        return searchBFSDirectionOpt(arg, Containers::Graph::transposeOf(arg), source, config);
+    }
+
+    /**
+     * @brief Level-synchronous parallel BFS from `source` over `thread_count` workers, counting the calling thread. Workers pull chunks of the current frontier from a shared cursor and claim nodes through an `AtomicBitset`. Each worker keeps a private next-frontier buffer, and the buffers are merged at every level barrier. Levels match `searchBFS`; parents are valid BFS-tree parents, and `order` is grouped by level, but ordering within a level depends on scheduling.
+     * 
+     * @param arg a graph whose const `neighbors(index)` is safe to call concurrently
+     * @param source index of the start node
+     * @param thread_count number of workers (at least 1)
+     * @return BfsResult (empty if `source` is out of range)
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] BfsResult searchBFSParallel(const G& arg, int source, unsigned int thread_count = std::thread::hardware_concurrency()) {
+        constexpr std::size_t chunk_size = 64;
+        const auto node_count = arg.size();
+
+        if (source < 0 or static_cast<std::size_t>(source) >= node_count) {
+            return {};
+        }
+
+        const auto worker_count = std::max(thread_count, 1U);
+        Containers::Bitset::AtomicBitset visited (node_count);
+        std::vector<int> frontier {source};
+        std::vector<std::vector<int>> local_frontiers (worker_count);
+        std::atomic<std::size_t> frontier_cursor {0};
+        auto level = 0;
+        auto done = false;
+        BfsResult result {
+            .order = {source},
+            .levels = std::vector<int>(node_count, no_node),
+            .parents = std::vector<int>(node_count, no_node)
+        };
+
+        result.order.reserve(node_count);
+        visited.set(source);
+        result.levels[source] = 0;
+
+        /// NOTE: runs on exactly one worker once all have arrived, so it may touch the shared frontier freely.
+        auto merge_level = [&]() noexcept {
+            frontier.clear();
+
+            for (auto& local_frontier : local_frontiers) {
+                frontier.insert(frontier.end(), local_frontier.cbegin(), local_frontier.cend());
+                local_frontier.clear();
+            }
+
+            result.order.insert(result.order.end(), frontier.cbegin(), frontier.cend());
+            frontier_cursor.store(0, std::memory_order_relaxed);
+            ++level;
+            done = frontier.empty();
+        };
+
+        std::barrier level_sync (static_cast<std::ptrdiff_t>(worker_count), merge_level);
+
+        auto expand_levels = [&](unsigned int worker_id) {
+            auto& local_frontier = local_frontiers[worker_id];
+
+            while (not done) {
+                const auto next_level = level + 1;
+
+                for (auto chunk_begin = frontier_cursor.fetch_add(chunk_size, std::memory_order_relaxed); chunk_begin < frontier.size(); chunk_begin = frontier_cursor.fetch_add(chunk_size, std::memory_order_relaxed)) {
+                    const auto chunk_end = std::min(chunk_begin + chunk_size, frontier.size());
+
+                    for (auto frontier_idx = chunk_begin; frontier_idx < chunk_end; frontier_idx++) {
+                        const auto temp = frontier[frontier_idx];
+
+                        for (const auto& adj_edge : arg.neighbors(temp)) {
+                            if (const auto adj_index = Containers::Graph::destinationOf(adj_edge); not visited.testAndSet(adj_index)) {
+                                result.levels[adj_index] = next_level;
+                                result.parents[adj_index] = temp;
+                                local_frontier.emplace_back(adj_index);
+                            }
+                        }
+                    }
+                }
+
+                level_sync.arrive_and_wait();
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        workers.reserve(worker_count - 1);
+
+        for (auto worker_id = 1U; worker_id < worker_count; worker_id++) {
+            workers.emplace_back(expand_levels, worker_id);
+        }
+
+        expand_levels(0);
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        return result;
+    }
 }
\ No newline at end of file
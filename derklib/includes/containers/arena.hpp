@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DerkLib::Containers::Memory {
+    /**
+     * @brief Bump allocator that carves allocations out of large chunks. Individual frees are no-ops: memory is only reclaimed in bulk by `reset()`, which rewinds into the retained chunks, or by `release()`, which frees them. The arena must outlive every container allocating from it.
+     */
+    class Arena {
+    public:
+        static constexpr std::size_t default_chunk_size = 64 * 1024;
+
+    private:
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        std::vector<std::size_t> m_chunk_sizes;
+        std::size_t m_chunk_size;
+        std::size_t m_active_chunk;
+        std::size_t m_cursor;
+        std::size_t m_used_bytes;
+
+        /// NOTE: alignment is applied to the address rather than the chunk offset, since chunks only carry the default `new` alignment.
+        [[nodiscard]] std::size_t alignedCursor(std::size_t alignment) const noexcept {
+            const auto chunk_base = reinterpret_cast<std::uintptr_t>(m_chunks[m_active_chunk].get());
+            const auto aligned_address = (chunk_base + m_cursor + alignment - 1) / alignment * alignment;
+
+            return static_cast<std::size_t>(aligned_address - chunk_base);
+        }
+
+        [[nodiscard]] bool fitsActive(std::size_t bytes, std::size_t alignment) const noexcept {
+            return m_active_chunk < m_chunks.size() and alignedCursor(alignment) + bytes <= m_chunk_sizes[m_active_chunk];
+        }
+
+    public:
+        explicit Arena(std::size_t chunk_size = default_chunk_size)
+        : m_chunks {}, m_chunk_sizes {}, m_chunk_size {std::max<std::size_t>(chunk_size, 64)}, m_active_chunk {0}, m_cursor {0}, m_used_bytes {0} {}
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        [[nodiscard]] void* allocate(std::size_t bytes, std::size_t alignment) {
+            /// NOTE: advance through retained chunks before growing, so `reset()` reuses them.
+            while (not fitsActive(bytes, alignment)) {
+                if (m_active_chunk + 1 < m_chunks.size()) {
+                    ++m_active_chunk;
+                    m_cursor = 0;
+                    continue;
+                }
+
+                /// NOTE: oversized requests get a dedicated chunk, with slack for over-alignment.
+                const auto new_size = std::max(m_chunk_size, bytes + alignment);
+
+                m_chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(new_size));
+                m_chunk_sizes.emplace_back(new_size);
+                m_active_chunk = m_chunks.size() - 1;
+                m_cursor = 0;
+            }
+
+            const auto aligned_cursor = alignedCursor(alignment);
+
+            m_cursor = aligned_cursor + bytes;
+            m_used_bytes += bytes;
+
+            return m_chunks[m_active_chunk].get() + aligned_cursor;
+        }
+
+        /// NOTE: rewinds to the first chunk & keeps all chunks for reuse. Every object allocated from this arena is invalidated.
+        void reset() noexcept {
+            m_active_chunk = 0;
+            m_cursor = 0;
+            m_used_bytes = 0;
+        }
+
+        /// NOTE: frees every chunk. Every object allocated from this arena is invalidated.
+        void release() noexcept {
+            m_chunks.clear();
+            m_chunk_sizes.clear();
+            reset();
+        }
+
+        [[nodiscard]] std::size_t bytesUsed() const noexcept {
+            return m_used_bytes;
+        }
+
+        [[nodiscard]] std::size_t bytesReserved() const noexcept {
+            std::size_t total = 0;
+
+            for (const auto chunk_size : m_chunk_sizes) {
+                total += chunk_size;
+            }
+
+            return total;
+        }
+
+        [[nodiscard]] std::size_t chunkCount() const noexcept {
+            return m_chunks.size();
+        }
+    };
+
+    /**
+     * @brief Standard allocator adaptor drawing from a shared `Arena`. It suits node-based containers like the `std::forward_list` adjacency of `Graph`, whose nodes then sit back to back in arena chunks.
+     * 
+     * @tparam U 
+     */
+    template <typename U>
+    class ArenaAllocator {
+    private:
+        template <typename V>
+        friend class ArenaAllocator;
+
+        Arena* m_arena;
+
+    public:
+        using value_type = U;
+
+        explicit ArenaAllocator(Arena& arena) noexcept
+        : m_arena {&arena} {}
+
+        template <typename V>
+        ArenaAllocator(const ArenaAllocator<V>& other) noexcept
+        : m_arena {other.m_arena} {}
+
+        [[nodiscard]] U* allocate(std::size_t count) {
+            return static_cast<U*>(m_arena->allocate(count * sizeof(U), alignof(U)));
+        }
+
+        void deallocate([[maybe_unused]] U* ptr, [[maybe_unused]] std::size_t count) noexcept {}
+
+        [[nodiscard]] Arena& arena() const noexcept {
+            return *m_arena;
+        }
+
+        template <typename V>
+        [[nodiscard]] bool operator==(const ArenaAllocator<V>& other) const noexcept {
+            return m_arena == other.m_arena;
+        }
+    };
+}
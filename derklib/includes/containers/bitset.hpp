@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace DerkLib::Containers::Bitset {
+    /**
+     * @brief Runtime-sized bitset packed into 64-bit words, e.g. for visited marks over graph node indices. Bit positions are not bounds-checked.
+     */
+    class DynamicBitset {
+    public:
+        using Word = std::uint64_t;
+
+        static constexpr std::size_t word_bits = 64;
+
+    private:
+        std::vector<Word> m_words;
+        std::size_t m_size;
+
+    public:
+        DynamicBitset()
+        : m_words {}, m_size {0} {}
+
+        explicit DynamicBitset(std::size_t size)
+        : m_words ((size + word_bits - 1) / word_bits, Word {0}), m_size {size} {}
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        /**
+         * @brief Grows or shrinks to `size` bits. New bits start cleared.
+         */
+        void resize(std::size_t size) {
+            m_words.resize((size + word_bits - 1) / word_bits, Word {0});
+
+            if (const auto tail_bits = size % word_bits; size < m_size and tail_bits != 0) {
+                m_words.back() &= (Word {1} << tail_bits) - 1;
+            }
+
+            m_size = size;
+        }
+
+        [[nodiscard]] bool test(std::size_t pos) const noexcept {
+            return (m_words[pos / word_bits] >> (pos % word_bits)) & Word {1};
+        }
+
+        void set(std::size_t pos) noexcept {
+            m_words[pos / word_bits] |= Word {1} << (pos % word_bits);
+        }
+
+        void reset(std::size_t pos) noexcept {
+            m_words[pos / word_bits] &= ~(Word {1} << (pos % word_bits));
+        }
+
+        /**
+         * @brief Sets the bit at `pos`, returning whether it was already set.
+         */
+        [[nodiscard]] bool testAndSet(std::size_t pos) noexcept {
+            auto& word = m_words[pos / word_bits];
+            const auto mask = Word {1} << (pos % word_bits);
+            const bool was_set = (word & mask) != 0;
+
+            word |= mask;
+
+            return was_set;
+        }
+
+        void clear() noexcept {
+            std::fill(m_words.begin(), m_words.end(), Word {0});
+        }
+
+        [[nodiscard]] std::size_t count() const noexcept {
+            std::size_t total = 0;
+
+            for (const auto word : m_words) {
+                total += static_cast<std::size_t>(std::popcount(word));
+            }
+
+            return total;
+        }
+    };
+
+    /**
+     * @brief Fixed-size bitset of atomic 64-bit words whose `testAndSet` lets several threads race to claim a position, exactly one of them winning. Bit positions are not bounds-checked.
+     */
+    class AtomicBitset {
+    public:
+        using Word = std::uint64_t;
+
+        static constexpr std::size_t word_bits = 64;
+
+    private:
+        std::unique_ptr<std::atomic<Word>[]> m_words;
+        std::size_t m_word_count;
+        std::size_t m_size;
+
+    public:
+        AtomicBitset()
+        : m_words {}, m_word_count {0}, m_size {0} {}
+
+        explicit AtomicBitset(std::size_t size)
+        : m_words {std::make_unique<std::atomic<Word>[]>((size + word_bits - 1) / word_bits)}, m_word_count {(size + word_bits - 1) / word_bits}, m_size {size} {}
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_size;
+        }
+
+        [[nodiscard]] bool test(std::size_t pos) const noexcept {
+            return (m_words[pos / word_bits].load(std::memory_order_relaxed) >> (pos % word_bits)) & Word {1};
+        }
+
+        void set(std::size_t pos) noexcept {
+            m_words[pos / word_bits].fetch_or(Word {1} << (pos % word_bits), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Atomically sets the bit at `pos`, returning whether it was already set. A plain load runs first, so already-claimed positions cost no read-modify-write.
+         */
+        [[nodiscard]] bool testAndSet(std::size_t pos) noexcept {
+            const auto mask = Word {1} << (pos % word_bits);
+            auto& word = m_words[pos / word_bits];
+
+            if (word.load(std::memory_order_relaxed) & mask) {
+                return true;
+            }
+
+            return (word.fetch_or(mask, std::memory_order_relaxed) & mask) != 0;
+        }
+
+        /// NOTE: not safe to call while other threads use this bitset.
+        void clear() noexcept {
+            for (std::size_t word_idx = 0; word_idx < m_word_count; word_idx++) {
+                m_words[word_idx].store(Word {0}, std::memory_order_relaxed);
+            }
+        }
+    };
+}
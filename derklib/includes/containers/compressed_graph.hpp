@@ -0,0 +1,266 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "containers/graph.hpp"
+#include "meta/graphs.hpp"
+
+namespace DerkLib::Containers::Graph {
+    namespace Impl {
+        /// NOTE: LEB128 style: 7 payload bits per byte, low bits first, with the top bit set on every byte but the last.
+        inline void appendVarint(std::vector<std::uint8_t>& bytes, std::uint32_t value) {
+            while (value >= 0x80U) {
+                bytes.emplace_back(static_cast<std::uint8_t>(value | 0x80U));
+                value >>= 7;
+            }
+
+            bytes.emplace_back(static_cast<std::uint8_t>(value));
+        }
+
+        [[nodiscard]] inline const std::uint8_t* readVarint(const std::uint8_t* cursor, std::uint32_t& value) noexcept {
+            value = 0;
+
+            for (auto shift = 0U; ; shift += 7) {
+                const auto byte = *cursor++;
+
+                value |= static_cast<std::uint32_t>(byte & 0x7FU) << shift;
+
+                if ((byte & 0x80U) == 0) {
+                    return cursor;
+                }
+            }
+        }
+
+        /**
+         * @brief Decodes one node's packed run of a `CompressedGraph` on the fly, yielding destination indices, or `<cost, destination-index>` pairs for weighted graphs, by value. Each step reads one gap varint plus `sizeof(W)` raw cost bytes.
+         */
+        template <PathPolicy P, typename W>
+        class PackedEdgeIterator {
+        private:
+            const std::uint8_t* m_cursor;
+            const std::uint8_t* m_next;
+            const std::uint8_t* m_end;
+            int m_target;
+            W m_cost;
+            bool m_first;
+
+            void decode() noexcept {
+                if (m_cursor == m_end) {
+                    return;
+                }
+
+                std::uint32_t gap;
+
+                m_next = readVarint(m_cursor, gap);
+
+                if (m_first) {
+                    /// NOTE: the first destination is stored relative to its own node, zigzag-encoded, so well-ordered graphs keep it to a byte or two.
+                    m_target += static_cast<int>(gap >> 1) ^ -static_cast<int>(gap & 1U);
+                    m_first = false;
+                } else {
+                    m_target += static_cast<int>(gap);
+                }
+
+                if constexpr (P == PathPolicy::weighted) {
+                    std::memcpy(&m_cost, m_next, sizeof(W));
+                    m_next += sizeof(W);
+                }
+            }
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::conditional_t<P == PathPolicy::weighted, WeightedEdgeOf<W>, int>;
+            using difference_type = std::ptrdiff_t;
+
+            PackedEdgeIterator() noexcept
+            : m_cursor {nullptr}, m_next {nullptr}, m_end {nullptr}, m_target {0}, m_cost {}, m_first {true} {}
+
+            PackedEdgeIterator(const std::uint8_t* cursor, const std::uint8_t* end, int node) noexcept
+            : m_cursor {cursor}, m_next {cursor}, m_end {end}, m_target {node}, m_cost {}, m_first {true} {
+                decode();
+            }
+
+            [[nodiscard]] value_type operator*() const noexcept {
+                if constexpr (P == PathPolicy::weighted) {
+                    return {m_cost, m_target};
+                } else {
+                    return m_target;
+                }
+            }
+
+            PackedEdgeIterator& operator++() noexcept {
+                m_cursor = m_next;
+                decode();
+
+                return *this;
+            }
+
+            PackedEdgeIterator operator++(int) noexcept {
+                auto temp = *this;
+                ++(*this);
+
+                return temp;
+            }
+
+            [[nodiscard]] bool operator==(const PackedEdgeIterator& other) const noexcept {
+                return m_cursor == other.m_cursor;
+            }
+        };
+    }
+
+    /**
+     * @brief Immutable graph whose neighbor runs are sorted, delta-encoded & packed as varints into one byte array, decoding on the fly as `neighbors(index)` is walked. Node `i`'s run spans bytes `[m_offsets[i], m_offsets[i + 1])`. Weighted runs interleave each gap with the raw bytes of its `W` cost, so narrow cost types shrink edges further. Suits memory-bound graphs where CSR's 4 to 8 bytes per edge are too many.
+     * 
+     * @tparam P 
+     * @tparam T 
+     * @tparam W edge cost type, ignored by unweighted graphs
+     */
+    template <PathPolicy P, typename T, typename W = int>
+    class CompressedGraph {
+    public:
+        using PosOpt = std::optional<int>;
+        using ItemPtr = const T*;
+        using EdgeIterator = Impl::PackedEdgeIterator<P, W>;
+
+    private:
+        std::vector<T> m_items;
+        std::vector<std::size_t> m_offsets;
+        std::vector<std::uint8_t> m_bytes;
+        std::size_t m_edge_count;
+
+    public:
+        CompressedGraph()
+        : m_items {}, m_offsets (1, 0), m_bytes {}, m_edge_count {0} {}
+
+        CompressedGraph(std::vector<T> items, std::vector<std::size_t> offsets, std::vector<std::uint8_t> bytes, std::size_t edge_count) noexcept
+        : m_items (std::move(items)), m_offsets (std::move(offsets)), m_bytes (std::move(bytes)), m_edge_count {edge_count} {}
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_items.size();
+        }
+
+        [[nodiscard]] std::size_t edgeCount() const noexcept {
+            return m_edge_count;
+        }
+
+        /**
+         * @brief Gives the size of the packed adjacency in bytes, excluding items & offsets.
+         */
+        [[nodiscard]] std::size_t encodedBytes() const noexcept {
+            return m_bytes.size();
+        }
+
+        const T& first() const& noexcept {
+            return m_items[0];
+        }
+
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            if (auto item_it = std::find(m_items.cbegin(), m_items.cend(), item); item_it != m_items.cend()) {
+                return static_cast<int>(item_it - m_items.cbegin());
+            }
+
+            return {};
+        }
+
+        /**
+         * @brief Lazily decodes the neighbors of the node at `index` in ascending destination order, without allocating.
+         */
+        [[nodiscard]] std::ranges::subrange<EdgeIterator> neighbors(int index) const& noexcept {
+            const auto* run_begin = m_bytes.data() + m_offsets[index];
+            const auto* run_end = m_bytes.data() + m_offsets[index + 1];
+
+            return {EdgeIterator {run_begin, run_end, index}, EdgeIterator {run_end, run_end, index}};
+        }
+
+        [[nodiscard]] std::vector<ItemPtr> neighborsOf(const T& arg) const& {
+            auto target_index = indexOf(arg);
+
+            if (not target_index) {
+                return {};
+            }
+
+            std::vector<ItemPtr> result;
+
+            for (const auto& neighbor_edge : neighbors(target_index.value())) {
+                result.emplace_back(m_items.data() + destinationOf(neighbor_edge));
+            }
+
+            return result;
+        }
+    };
+
+    /**
+     * @brief Packs any indexed graph (`Graph`, `CsrGraph`, ...) into a `CompressedGraph` with the same items & cost type. Each neighbor run is sorted by destination, then written as gaps between consecutive destinations, so parallel edges cost a single zero byte plus their cost.
+     * 
+     * @tparam G 
+     * @param arg 
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] auto compressOf(const G& arg) {
+        using Item = Meta::Graphs::GraphItemOf<G>;
+        using Cost = Meta::Graphs::GraphCostOf<G>;
+        constexpr auto graph_policy = Meta::Graphs::WeightedGraphKind<G> ? PathPolicy::weighted : PathPolicy::unweighted;
+
+        const auto node_count = static_cast<int>(arg.size());
+        std::vector<Item> items;
+        std::vector<std::size_t> offsets;
+        std::vector<std::uint8_t> bytes;
+        std::vector<std::pair<int, Cost>> run_edges; // <destination, cost>
+        std::size_t edge_count = 0;
+
+        items.reserve(node_count);
+        offsets.reserve(node_count + 1);
+        offsets.emplace_back(0);
+
+        for (auto node = 0; node < node_count; node++) {
+            items.emplace_back(arg.itemAt(node));
+            run_edges.clear();
+
+            for (const auto& edge : arg.neighbors(node)) {
+                if constexpr (graph_policy == PathPolicy::weighted) {
+                    run_edges.emplace_back(edge.second, edge.first);
+                } else {
+                    run_edges.emplace_back(edge, Cost {});
+                }
+            }
+
+            std::ranges::sort(run_edges);
+
+            for (auto slot = 0; slot < static_cast<int>(run_edges.size()); slot++) {
+                const auto& [destination, cost] = run_edges[slot];
+
+                if (slot == 0) {
+                    const auto offset = destination - node;
+
+                    Impl::appendVarint(bytes, (static_cast<std::uint32_t>(offset) << 1) ^ static_cast<std::uint32_t>(offset >> 31));
+                } else {
+                    Impl::appendVarint(bytes, static_cast<std::uint32_t>(destination - run_edges[slot - 1].first));
+                }
+
+                if constexpr (graph_policy == PathPolicy::weighted) {
+                    const auto* cost_bytes = reinterpret_cast<const std::uint8_t*>(&cost);
+
+                    bytes.insert(bytes.end(), cost_bytes, cost_bytes + sizeof(Cost));
+                }
+            }
+
+            edge_count += run_edges.size();
+            offsets.emplace_back(bytes.size());
+        }
+
+        bytes.shrink_to_fit();
+
+        return CompressedGraph<graph_policy, Item, Cost> {std::move(items), std::move(offsets), std::move(bytes), edge_count};
+    }
+}
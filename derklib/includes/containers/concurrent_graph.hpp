@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "containers/arena.hpp"
+#include "containers/graph.hpp"
+
+namespace DerkLib::Containers::Graph {
+    /**
+     * @brief Graph for multi-producer edge ingestion over pre-registered nodes. Each node's adjacency is a lock-free singly linked stack: an edge append allocates its link from the calling `Writer`'s private arena and publishes it with one CAS on the node's atomic head, so producers never share a lock or allocator. Like `Graph`, `neighbors(index)` yields the newest edges first. Reads may run alongside writers and see a consistent prefix of each list; call `freeze()` once ingestion ends for a compact `CsrGraph`.
+     * 
+     * @tparam P 
+     * @tparam T 
+     * @tparam W edge cost type, ignored by unweighted graphs
+     */
+    template <PathPolicy P, typename T, typename W = int>
+    class ConcurrentGraph {
+    public:
+        using PosOpt = std::optional<int>;
+        using Edge = std::conditional_t<P == PathPolicy::weighted, WeightedEdgeOf<W>, int>;
+
+    private:
+        struct EdgeLink {
+            const EdgeLink* next;
+            Edge edge;
+        };
+
+        /**
+         * @brief Walks one node's edge stack from the head loaded at construction.
+         */
+        class LinkIterator {
+        private:
+            const EdgeLink* m_link;
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = Edge;
+            using difference_type = std::ptrdiff_t;
+
+            LinkIterator() noexcept
+            : m_link {nullptr} {}
+
+            explicit LinkIterator(const EdgeLink* link) noexcept
+            : m_link {link} {}
+
+            [[nodiscard]] const Edge& operator*() const noexcept {
+                return m_link->edge;
+            }
+
+            LinkIterator& operator++() noexcept {
+                m_link = m_link->next;
+
+                return *this;
+            }
+
+            LinkIterator operator++(int) noexcept {
+                auto temp = *this;
+                ++(*this);
+
+                return temp;
+            }
+
+            [[nodiscard]] bool operator==(const LinkIterator& other) const noexcept {
+                return m_link == other.m_link;
+            }
+        };
+
+        std::vector<T> m_items;
+        std::unique_ptr<std::atomic<const EdgeLink*>[]> m_heads;
+        std::vector<std::unique_ptr<Memory::Arena>> m_arenas;
+        std::mutex m_arenas_mutex;
+        std::size_t m_chunk_size;
+
+        void push(int from_index, const Edge& edge, Memory::Arena& arena) {
+            auto& head = m_heads[from_index];
+            auto* link = ::new (arena.allocate(sizeof(EdgeLink), alignof(EdgeLink))) EdgeLink {head.load(std::memory_order_relaxed), edge};
+
+            /// NOTE: release publishes the link's fields, and the CAS chain on `head` keeps earlier pushes visible to any acquiring reader.
+            while (not head.compare_exchange_weak(link->next, link, std::memory_order_release, std::memory_order_relaxed)) {}
+        }
+
+    public:
+        /**
+         * @brief Per-thread ingestion handle. It is cheap to copy, but it must not be shared between threads, since it bump-allocates from one arena without locking.
+         */
+        class Writer {
+        private:
+            ConcurrentGraph* m_graph;
+            Memory::Arena* m_arena;
+
+        public:
+            Writer(ConcurrentGraph& graph, Memory::Arena& arena) noexcept
+            : m_graph {&graph}, m_arena {&arena} {}
+
+            /**
+             * @brief Lock-free `Graph::connectAt`. Indices must be in `[0, size())`.
+             */
+            void connectAt(int from_index, int to_index, DirectFlag flag) requires (P == PathPolicy::unweighted) {
+                m_graph->push(from_index, to_index, *m_arena);
+
+                if (flag == DirectFlag::two_way) {
+                    m_graph->push(to_index, from_index, *m_arena);
+                }
+            }
+
+            void connectAt(int from_index, int to_index, W cost, DirectFlag flag) requires (P == PathPolicy::weighted) {
+                m_graph->push(from_index, {cost, to_index}, *m_arena);
+
+                if (flag == DirectFlag::two_way) {
+                    m_graph->push(to_index, {cost, from_index}, *m_arena);
+                }
+            }
+        };
+
+        explicit ConcurrentGraph(std::vector<T> items, std::size_t chunk_size = Memory::Arena::default_chunk_size)
+        : m_items (std::move(items)), m_heads {std::make_unique<std::atomic<const EdgeLink*>[]>(m_items.size())}, m_arenas {}, m_arenas_mutex {}, m_chunk_size {chunk_size} {}
+
+        ConcurrentGraph(const ConcurrentGraph&) = delete;
+        ConcurrentGraph& operator=(const ConcurrentGraph&) = delete;
+
+        /**
+         * @brief Hands out a `Writer` with its own arena. Only this registration takes a lock, so call it once per producer thread rather than per edge. The arena lives as long as the graph.
+         */
+        [[nodiscard]] Writer writer() {
+            std::scoped_lock arenas_lock {m_arenas_mutex};
+
+            m_arenas.emplace_back(std::make_unique<Memory::Arena>(m_chunk_size));
+
+            return {*this, *m_arenas.back()};
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_items.size();
+        }
+
+        const T& first() const& noexcept {
+            return m_items[0];
+        }
+
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            if (auto item_it = std::find(m_items.cbegin(), m_items.cend(), item); item_it != m_items.cend()) {
+                return static_cast<int>(item_it - m_items.cbegin());
+            }
+
+            return {};
+        }
+
+        [[nodiscard]] std::ranges::subrange<LinkIterator> neighbors(int index) const& noexcept {
+            return {LinkIterator {m_heads[index].load(std::memory_order_acquire)}, LinkIterator {}};
+        }
+
+        /**
+         * @brief Packs the ingested edges into an immutable `CsrGraph`, keeping the newest-first order of `neighbors`. Call this after every writer has finished.
+         */
+        [[nodiscard]] CsrGraph<P, T, W> freeze() const {
+            std::vector<int> offsets;
+            std::vector<int> targets;
+            std::vector<W> costs;
+
+            offsets.reserve(m_items.size() + 1);
+            offsets.emplace_back(0);
+
+            for (auto index = 0; index < static_cast<int>(m_items.size()); index++) {
+                offsets.emplace_back(offsets.back() + static_cast<int>(std::ranges::distance(neighbors(index))));
+            }
+
+            targets.reserve(offsets.back());
+
+            if constexpr (P == PathPolicy::weighted) {
+                costs.reserve(offsets.back());
+            }
+
+            for (auto index = 0; index < static_cast<int>(m_items.size()); index++) {
+                for (const auto& edge : neighbors(index)) {
+                    targets.emplace_back(destinationOf(edge));
+
+                    if constexpr (P == PathPolicy::weighted) {
+                        costs.emplace_back(edge.first);
+                    }
+                }
+            }
+
+            if constexpr (P == PathPolicy::weighted) {
+                return {m_items, std::move(offsets), std::move(targets), std::move(costs)};
+            } else {
+                return {m_items, std::move(offsets), std::move(targets)};
+            }
+        }
+    };
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "containers/graph.hpp"
+
+namespace DerkLib::Containers::Graph {
+    namespace Impl {
+        /**
+         * @brief Edges & the largest node ID parsed from one newline-aligned chunk of an edge-list file.
+         */
+        template <typename Edge>
+        struct EdgeListChunk {
+            std::vector<Edge> edges;
+            int max_node = -1;
+            bool malformed = false;
+        };
+
+        /// NOTE: node IDs index the node array directly, so an ID space this much larger than the edge list is taken as sparse or crafted input rather than allocated. Every line names at most 2 nodes, and the slack keeps tiny hand-written lists loadable.
+        inline constexpr std::size_t max_nodes_per_edge = 4;
+        inline constexpr std::size_t node_count_slack = 1024;
+
+        [[nodiscard]] inline bool isBlank(char symbol) noexcept {
+            return symbol == ' ' or symbol == '\t' or symbol == '\r';
+        }
+
+        [[nodiscard]] inline const char* skipBlanks(const char* cursor, const char* end) noexcept {
+            while (cursor < end and isBlank(*cursor)) {
+                ++cursor;
+            }
+
+            return cursor;
+        }
+
+        [[nodiscard]] inline const char* skipToken(const char* cursor, const char* end) noexcept {
+            while (cursor < end and not isBlank(*cursor)) {
+                ++cursor;
+            }
+
+            return cursor;
+        }
+
+        /**
+         * @brief Parses the `src dst [cost]` lines of `[begin, end)` in place with `std::from_chars`, so no line is ever copied into a string. Blank lines & lines starting with `#` or `%` are skipped. Unweighted lists skip a trailing cost column without converting it, so real-valued costs load too, and weighted ones default a missing cost to 1. Negative or NaN costs, which the shortest-path searches cannot handle, and anything past the cost column mark the chunk malformed.
+         */
+        template <typename Edge>
+        void parseEdgeLines(const char* begin, const char* end, EdgeListChunk<Edge>& chunk) {
+            constexpr auto is_weighted = std::tuple_size_v<Edge> == 3;
+
+            for (auto line_begin = begin; line_begin < end; ) {
+                const auto* newline = static_cast<const char*>(std::memchr(line_begin, '\n', static_cast<std::size_t>(end - line_begin)));
+                const auto* line_end = (newline != nullptr) ? newline : end;
+                auto cursor = skipBlanks(line_begin, line_end);
+
+                line_begin = line_end + 1;
+
+                if (cursor == line_end or *cursor == '#' or *cursor == '%') {
+                    continue;
+                }
+
+                int from = -1;
+                int to = -1;
+                auto [from_end, from_error] = std::from_chars(cursor, line_end, from);
+                cursor = skipBlanks(from_end, line_end);
+                auto [to_end, to_error] = std::from_chars(cursor, line_end, to);
+                cursor = skipBlanks(to_end, line_end);
+
+                if (from_error != std::errc {} or to_error != std::errc {} or from < 0 or to < 0) {
+                    chunk.malformed = true;
+                    return;
+                }
+
+                if constexpr (is_weighted) {
+                    std::tuple_element_t<2, Edge> cost {1};
+
+                    if (cursor != line_end) {
+                        auto [cost_end, cost_error] = std::from_chars(cursor, line_end, cost);
+                        cursor = skipBlanks(cost_end, line_end);
+
+                        if (cost_error != std::errc {} or not (cost >= decltype(cost) {})) {
+                            chunk.malformed = true;
+                            return;
+                        }
+                    }
+
+                    chunk.edges.emplace_back(from, to, cost);
+                } else {
+                    cursor = skipBlanks(skipToken(cursor, line_end), line_end);
+                    chunk.edges.emplace_back(from, to);
+                }
+
+                if (cursor != line_end) {
+                    chunk.malformed = true;
+                    return;
+                }
+
+                chunk.max_node = std::max({chunk.max_node, from, to});
+            }
+        }
+    }
+
+    /**
+     * @brief Loads a text edge list (`src dst [cost]` per line, whitespace separated) into a `CsrGraph` whose items are the node IDs, used directly as dense indices `[0, max ID]`. IDs must therefore be dense enough: a max ID of `INT_MAX` or a node count above `4 * edge count + 1024` is rejected instead of allocated. The file is memory-mapped and cut into `options.thread_count` newline-aligned chunks. Each chunk is parsed with `std::from_chars` on its own thread, straight from the mapped pages. The gathered edges are then handed to `buildCsrGraph` with the same `options`.
+     * 
+     * @tparam P `weighted` to keep the cost column
+     * @tparam W cost type for weighted lists; unweighted lists always yield `int` costs, like `buildCsrGraph`
+     * @param file_path 
+     * @param options build options; `thread_count` also sets the parsing workers
+     * @return std::optional<CsrGraph<P, int, W>> empty if the file cannot be mapped, a line is malformed or has a negative cost, or the node IDs are too sparse
+     */
+    template <PathPolicy P, typename W = int>
+    [[nodiscard]] std::optional<CsrGraph<P, int, std::conditional_t<P == PathPolicy::weighted, W, int>>> loadEdgeList(const std::filesystem::path& file_path, CsrBuildOptions options = {}) {
+        using Edge = std::conditional_t<P == PathPolicy::weighted, IndexCostEdgeOf<W>, IndexEdge>;
+        using Chunk = Impl::EdgeListChunk<Edge>;
+
+        const auto file_fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+
+        if (file_fd < 0) {
+            return {};
+        }
+
+        struct stat file_info {};
+
+        if (::fstat(file_fd, &file_info) != 0) {
+            ::close(file_fd);
+            return {};
+        }
+
+        const auto length = static_cast<std::size_t>(file_info.st_size);
+
+        if (length == 0) {
+            ::close(file_fd);
+            return CsrGraph<P, int, std::conditional_t<P == PathPolicy::weighted, W, int>> {};
+        }
+
+        void* base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file_fd, 0);
+
+        ::close(file_fd);
+
+        if (base == MAP_FAILED) {
+            return {};
+        }
+
+        ::madvise(base, length, MADV_SEQUENTIAL);
+
+        const auto* text = static_cast<const char*>(base);
+        const auto* text_end = text + length;
+        const auto chunk_count = static_cast<std::size_t>(std::max(options.thread_count, 1U));
+        std::vector<const char*> chunk_starts (chunk_count + 1, text_end);
+        std::vector<Chunk> chunks (chunk_count);
+
+        /// NOTE: every cut moves forward to just past a newline, so each line lands whole in exactly one chunk.
+        chunk_starts[0] = text;
+
+        for (std::size_t chunk = 1; chunk < chunk_count; chunk++) {
+            const auto* cut = std::max(text + length * chunk / chunk_count, chunk_starts[chunk - 1]);
+            const auto* newline = static_cast<const char*>(std::memchr(cut, '\n', static_cast<std::size_t>(text_end - cut)));
+
+            chunk_starts[chunk] = (newline != nullptr) ? newline + 1 : text_end;
+        }
+
+        {
+            std::vector<std::thread> workers;
+
+            workers.reserve(chunk_count - 1);
+
+            for (std::size_t chunk = 1; chunk < chunk_count; chunk++) {
+                workers.emplace_back(Impl::parseEdgeLines<Edge>, chunk_starts[chunk], chunk_starts[chunk + 1], std::ref(chunks[chunk]));
+            }
+
+            Impl::parseEdgeLines<Edge>(chunk_starts[0], chunk_starts[1], chunks[0]);
+
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        ::munmap(base, length);
+
+        if (std::ranges::any_of(chunks, [](const Chunk& chunk) noexcept { return chunk.malformed; })) {
+            return {};
+        }
+
+        /// NOTE: the first chunk's vector is grown in place, so a single-threaded load copies nothing.
+        auto edges = std::move(chunks[0].edges);
+        auto max_node = chunks[0].max_node;
+        std::size_t edge_total = edges.size();
+
+        for (std::size_t chunk = 1; chunk < chunk_count; chunk++) {
+            edge_total += chunks[chunk].edges.size();
+        }
+
+        edges.reserve(edge_total);
+
+        for (std::size_t chunk = 1; chunk < chunk_count; chunk++) {
+            edges.insert(edges.end(), chunks[chunk].edges.cbegin(), chunks[chunk].edges.cend());
+            max_node = std::max(max_node, chunks[chunk].max_node);
+            std::vector<Edge> {}.swap(chunks[chunk].edges);
+        }
+
+        if (max_node == std::numeric_limits<int>::max() or static_cast<std::size_t>(max_node) + 1 > Impl::max_nodes_per_edge * edge_total + Impl::node_count_slack) {
+            return {};
+        }
+
+        std::vector<int> nodes (static_cast<std::size_t>(max_node) + 1);
+
+        std::iota(nodes.begin(), nodes.end(), 0);
+
+        return buildCsrGraph(std::span {nodes}, std::span {edges}, options);
+    }
+}
@@ -2,9 +2,21 @@
 
 #include <utility>
 #include <algorithm>
+#include <concepts>
 #include <forward_list>
+#include <functional>
+#include <iterator>
+#include <memory>
 #include <optional>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
+#include "containers/bitset.hpp"
+#include "meta/graphs.hpp"
 
 namespace DerkLib::Containers::Graph {
     enum class DirectFlag {
@@ -17,51 +29,516 @@ namespace DerkLib::Containers::Graph {
         weighted
     };
 
-    template <PathPolicy P, typename T>
-    class Graph {};
+    enum class LookupPolicy {
+        linear_scan,
+        hashed
+    };
+
+    template <typename W>
+    using WeightedEdgeOf = std::pair<W, int>; // <cost, destination-index>
+
+    using WeightedEdge = WeightedEdgeOf<int>;
+
+    [[nodiscard]] constexpr int destinationOf(int edge) noexcept {
+        return edge;
+    }
+
+    template <typename W>
+    [[nodiscard]] constexpr int destinationOf(const WeightedEdgeOf<W>& edge) noexcept {
+        return edge.second;
+    }
+
+    using IndexEdge = std::pair<int, int>; // <from-index, to-index>
+
+    template <typename W>
+    using IndexCostEdgeOf = std::tuple<int, int, W>; // <from-index, to-index, cost>
+
+    using IndexCostEdge = IndexCostEdgeOf<int>;
 
     /**
-     * @brief This is a `Graph` specialization for an unweighted graph.
+     * @brief Options for `buildCsrGraph`. `deduplicate` implies `sort_neighbors`, and `thread_count` workers share the per-node sorting & deduplication passes.
+     */
+    struct CsrBuildOptions {
+        DirectFlag direction = DirectFlag::one_way;
+        bool sort_neighbors = false;
+        bool deduplicate = false;
+        unsigned int thread_count = 1;
+    };
+
+    /**
+     * @brief Describes an `IndexCostEdgeOf<W>` tuple for any arithmetic cost type `W`.
+     */
+    template <typename Edge>
+    concept IndexCostEdgeKind = requires {
+        typename std::tuple_size<Edge>::type;
+    } and std::tuple_size_v<Edge> == 3 and std::same_as<Edge, IndexCostEdgeOf<std::tuple_element_t<2, Edge>>> and std::is_arithmetic_v<std::tuple_element_t<2, Edge>>;
+
+    template <typename T>
+    concept HashableItem = requires (const T& arg) {
+        {std::hash<T> {}(arg)} -> std::convertible_to<std::size_t>;
+    };
+
+    namespace Impl {
+        /**
+         * @brief Maps a `Graph` item to its node index. The `linear_scan` policy stores nothing and searches the item vector, while the `hashed` policy keeps an item-to-index table for average O(1) lookups.
+         * 
+         * @tparam L 
+         * @tparam T 
+         */
+        template <LookupPolicy L, typename T>
+        class ItemLookup {};
+
+        template <typename T>
+        class ItemLookup <LookupPolicy::linear_scan, T> {
+        public:
+            [[nodiscard]] std::optional<int> find(const std::vector<T>& items, const Bitset::DynamicBitset& removed, const T& item) const noexcept {
+                auto index = 0;
+
+                for (const auto& temp : items) {
+                    if (item == temp and not removed.test(index)) {
+                        return index;
+                    }
+
+                    ++index;
+                }
+
+                return {};
+            }
+
+            void insert([[maybe_unused]] const T& item, [[maybe_unused]] int index) noexcept {}
+
+            void erase([[maybe_unused]] const T& item) noexcept {}
+
+            void rebuild([[maybe_unused]] const std::vector<T>& items, [[maybe_unused]] const Bitset::DynamicBitset& removed) noexcept {}
+        };
+
+        template <typename T>
+        class ItemLookup <LookupPolicy::hashed, T> {
+        private:
+            static_assert(HashableItem<T>, "LookupPolicy::hashed requires a std::hash specialization for T.");
+
+            std::unordered_map<T, int> m_indices;
+
+        public:
+            ItemLookup()
+            : m_indices {} {}
+
+            [[nodiscard]] std::optional<int> find([[maybe_unused]] const std::vector<T>& items, [[maybe_unused]] const Bitset::DynamicBitset& removed, const T& item) const noexcept {
+                if (auto index_it = m_indices.find(item); index_it != m_indices.cend()) {
+                    return index_it->second;
+                }
+
+                return {};
+            }
+
+            void insert(const T& item, int index) {
+                m_indices.emplace(item, index);
+            }
+
+            void erase(const T& item) {
+                m_indices.erase(item);
+            }
+
+            void rebuild(const std::vector<T>& items, const Bitset::DynamicBitset& removed) {
+                m_indices.clear();
+                m_indices.reserve(items.size());
+
+                auto index = 0;
+
+                for (const auto& item : items) {
+                    if (not removed.test(index)) {
+                        m_indices.emplace(item, index);
+                    }
+
+                    ++index;
+                }
+            }
+        };
+
+        /**
+         * @brief Walks the parallel cost & destination arrays of a weighted `CsrGraph`, yielding `<cost, destination-index>` pairs by value.
+         */
+        template <typename W>
+        class CsrEdgeIterator {
+        private:
+            const W* m_cost;
+            const int* m_target;
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = WeightedEdgeOf<W>;
+            using difference_type = std::ptrdiff_t;
+
+            CsrEdgeIterator() noexcept
+            : m_cost {nullptr}, m_target {nullptr} {}
+
+            CsrEdgeIterator(const W* cost, const int* target) noexcept
+            : m_cost {cost}, m_target {target} {}
+
+            [[nodiscard]] value_type operator*() const noexcept {
+                return {*m_cost, *m_target};
+            }
+
+            CsrEdgeIterator& operator++() noexcept {
+                ++m_cost;
+                ++m_target;
+
+                return *this;
+            }
+
+            CsrEdgeIterator operator++(int) noexcept {
+                auto temp = *this;
+                ++(*this);
+
+                return temp;
+            }
+
+            [[nodiscard]] bool operator==(const CsrEdgeIterator& other) const noexcept {
+                return m_target == other.m_target;
+            }
+        };
+
+        /**
+         * @brief Wraps a `Graph` adjacency iterator, skipping edges whose destination is tombstoned in `removed`. A null `removed` means the graph has no tombstones, so nothing is skipped.
+         */
+        template <typename BaseIter>
+        class LiveEdgeIterator {
+        private:
+            BaseIter m_it;
+            BaseIter m_end;
+            const Bitset::DynamicBitset* m_removed;
+
+            void skipRemoved() noexcept {
+                if (m_removed == nullptr) {
+                    return;
+                }
+
+                while (m_it != m_end and m_removed->test(destinationOf(*m_it))) {
+                    ++m_it;
+                }
+            }
+
+        public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type = std::iter_value_t<BaseIter>;
+            using difference_type = std::iter_difference_t<BaseIter>;
+
+            LiveEdgeIterator() noexcept
+            : m_it {}, m_end {}, m_removed {nullptr} {}
+
+            LiveEdgeIterator(BaseIter it, BaseIter end, const Bitset::DynamicBitset* removed) noexcept
+            : m_it {it}, m_end {end}, m_removed {removed} {
+                skipRemoved();
+            }
+
+            [[nodiscard]] std::iter_reference_t<BaseIter> operator*() const noexcept {
+                return *m_it;
+            }
+
+            LiveEdgeIterator& operator++() noexcept {
+                ++m_it;
+                skipRemoved();
+
+                return *this;
+            }
+
+            LiveEdgeIterator operator++(int) noexcept {
+                auto temp = *this;
+                ++(*this);
+
+                return temp;
+            }
+
+            [[nodiscard]] bool operator==(const LiveEdgeIterator& other) const noexcept {
+                return m_it == other.m_it;
+            }
+        };
+
+        /**
+         * @brief Splits nodes `[0, offsets.size() - 1)` into `thread_count` contiguous blocks holding roughly equal edge counts, running `fn(first_node, last_node)` for each block on its own thread.
+         */
+        template <typename Fn>
+        void forEachNodeBlock(const std::vector<int>& offsets, unsigned int thread_count, Fn&& fn) {
+            const auto node_count = static_cast<int>(offsets.size()) - 1;
+            const auto block_count = std::max(thread_count, 1U);
+
+            if (block_count == 1 or node_count < 2) {
+                fn(0, node_count);
+                return;
+            }
+
+            const auto edge_count = static_cast<long long>(offsets.back());
+            std::vector<std::thread> workers;
+            auto block_begin = 0;
+
+            workers.reserve(block_count);
+
+            for (auto block = 1U; block <= block_count and block_begin < node_count; block++) {
+                const auto edge_goal = static_cast<int>(edge_count * block / block_count);
+                auto block_end = (block == block_count) ? node_count : static_cast<int>(std::upper_bound(offsets.cbegin() + block_begin + 1, offsets.cend() - 1, edge_goal) - offsets.cbegin());
+
+                block_end = std::max(block_end, block_begin + 1);
+                workers.emplace_back(fn, block_begin, block_end);
+                block_begin = block_end;
+            }
+
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+    }
+
+    template <PathPolicy P, typename T, typename W = int>
+    class CsrGraph {};
+
+    /**
+     * @brief This is an immutable, compressed-sparse-row snapshot of an unweighted `Graph`. Every node's neighbors sit in one contiguous run of `m_targets`, which starts at `m_offsets[i]` and ends at `m_offsets[i + 1]`.
      * 
      * @tparam T 
+     * @tparam W unused, kept so both policies share one parameter list
      */
-    template <typename T>
-    class Graph <PathPolicy::unweighted, T> {
+    template <typename T, typename W>
+    class CsrGraph <PathPolicy::unweighted, T, W> {
     public:
-        using AdjList = std::forward_list<int>;
         using PosOpt = std::optional<int>;
         using ItemPtr = const T*;
 
     private:
         std::vector<T> m_items;
-        std::vector<AdjList> m_adj;
+        std::vector<int> m_offsets;
+        std::vector<int> m_targets;
 
-        [[nodiscard]] PosOpt indexOfItem(const T& item) const noexcept {
-            auto index = 0;
+    public:
+        CsrGraph()
+        : m_items {}, m_offsets (1, 0), m_targets {} {}
 
-            for (const auto& temp : m_items) {
-                if (item == temp) {
-                    return index;
-                }
+        CsrGraph(std::vector<T> items, std::vector<int> offsets, std::vector<int> targets) noexcept
+        : m_items (std::move(items)), m_offsets (std::move(offsets)), m_targets (std::move(targets)) {}
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_items.size();
+        }
+
+        [[nodiscard]] std::size_t edgeCount() const noexcept {
+            return m_targets.size();
+        }
+
+        const T& first() const& noexcept {
+            return m_items[0];
+        }
+
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            if (auto item_it = std::find(m_items.cbegin(), m_items.cend(), item); item_it != m_items.cend()) {
+                return static_cast<int>(item_it - m_items.cbegin());
+            }
+
+            return {};
+        }
+
+        [[nodiscard]] std::span<const int> targetsOf(int index) const& noexcept {
+            return {m_targets.data() + m_offsets[index], m_targets.data() + m_offsets[index + 1]};
+        }
+
+        [[nodiscard]] std::span<const int> neighbors(int index) const& noexcept {
+            return targetsOf(index);
+        }
+
+        /// NOTE: raw CSR arrays, e.g. for serialization.
+        [[nodiscard]] std::span<const T> items() const& noexcept {
+            return m_items;
+        }
+
+        [[nodiscard]] std::span<const int> offsets() const& noexcept {
+            return m_offsets;
+        }
+
+        [[nodiscard]] std::span<const int> targets() const& noexcept {
+            return m_targets;
+        }
+
+        [[nodiscard]] std::vector<ItemPtr> neighborsOf(const T& arg) const& {
+            auto target_index = indexOf(arg);
+
+            if (not target_index) {
+                return {};
+            }
+
+            std::vector<ItemPtr> result;
 
-                ++index;
+            for (const auto neighbor_position : targetsOf(target_index.value())) {
+                result.emplace_back(m_items.data() + neighbor_position);
             }
 
-            if (static_cast<std::size_t>(index) < m_items.size()) {
-                return index;
+            return result;
+        }
+    };
+
+    /**
+     * @brief This is an immutable, compressed-sparse-row snapshot of a weighted `Graph`. Edge costs are kept in `m_costs`, parallel to `m_targets`, so cost-blind traversals never load them.
+     * 
+     * @tparam T 
+     * @tparam W edge cost type
+     */
+    template <typename T, typename W>
+    class CsrGraph <PathPolicy::weighted, T, W> {
+    public:
+        using PosOpt = std::optional<int>;
+        using ItemPtr = const T*;
+
+    private:
+        std::vector<T> m_items;
+        std::vector<int> m_offsets;
+        std::vector<int> m_targets;
+        std::vector<W> m_costs;
+
+    public:
+        CsrGraph()
+        : m_items {}, m_offsets (1, 0), m_targets {}, m_costs {} {}
+
+        CsrGraph(std::vector<T> items, std::vector<int> offsets, std::vector<int> targets, std::vector<W> costs) noexcept
+        : m_items (std::move(items)), m_offsets (std::move(offsets)), m_targets (std::move(targets)), m_costs (std::move(costs)) {}
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_items.size();
+        }
+
+        [[nodiscard]] std::size_t edgeCount() const noexcept {
+            return m_targets.size();
+        }
+
+        const T& first() const& noexcept {
+            return m_items[0];
+        }
+
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            if (auto item_it = std::find(m_items.cbegin(), m_items.cend(), item); item_it != m_items.cend()) {
+                return static_cast<int>(item_it - m_items.cbegin());
             }
 
             return {};
         }
 
+        [[nodiscard]] std::span<const int> targetsOf(int index) const& noexcept {
+            return {m_targets.data() + m_offsets[index], m_targets.data() + m_offsets[index + 1]};
+        }
+
+        [[nodiscard]] std::span<const W> costsOf(int index) const& noexcept {
+            return {m_costs.data() + m_offsets[index], m_costs.data() + m_offsets[index + 1]};
+        }
+
+        [[nodiscard]] std::ranges::subrange<Impl::CsrEdgeIterator<W>> neighbors(int index) const& noexcept {
+            return {
+                Impl::CsrEdgeIterator {m_costs.data() + m_offsets[index], m_targets.data() + m_offsets[index]},
+                Impl::CsrEdgeIterator {m_costs.data() + m_offsets[index + 1], m_targets.data() + m_offsets[index + 1]}
+            };
+        }
+
+        /// NOTE: raw CSR arrays, e.g. for serialization.
+        [[nodiscard]] std::span<const T> items() const& noexcept {
+            return m_items;
+        }
+
+        [[nodiscard]] std::span<const int> offsets() const& noexcept {
+            return m_offsets;
+        }
+
+        [[nodiscard]] std::span<const int> targets() const& noexcept {
+            return m_targets;
+        }
+
+        [[nodiscard]] std::span<const W> costs() const& noexcept {
+            return m_costs;
+        }
+
+        [[nodiscard]] std::vector<ItemPtr> neighborsOf(const T& arg) const& {
+            auto target_index = indexOf(arg);
+
+            if (not target_index) {
+                return {};
+            }
+
+            std::vector<ItemPtr> result;
+
+            for (const auto neighbor_position : targetsOf(target_index.value())) {
+                result.emplace_back(m_items.data() + neighbor_position);
+            }
+
+            return result;
+        }
+    };
+
+    /**
+     * @brief Mutable adjacency-list graph. `L` picks how items map to node indices. `Alloc` is the allocator template for the per-node `std::forward_list` edge storage, e.g. `Memory::ArenaAllocator` to pack edge nodes into bulk-freed chunks.
+     * 
+     * @tparam P 
+     * @tparam T 
+     * @tparam L 
+     * @tparam Alloc 
+     * @tparam W edge cost type of weighted graphs, e.g. `std::uint16_t` to narrow each edge
+     */
+    template <PathPolicy P, typename T, LookupPolicy L = LookupPolicy::linear_scan, template <typename> typename Alloc = std::allocator, typename W = int>
+    class Graph {};
+
+    /**
+     * @brief This is a `Graph` specialization for an unweighted graph.
+     * 
+     * @tparam T 
+     */
+    template <typename T, LookupPolicy L, template <typename> typename Alloc, typename W>
+    class Graph <PathPolicy::unweighted, T, L, Alloc, W> {
     public:
-        Graph()
-        : m_items {}, m_adj {} {}
+        using EdgeAllocator = Alloc<int>;
+        using AdjList = std::forward_list<int, EdgeAllocator>;
+        using PosOpt = std::optional<int>;
+        using ItemPtr = const T*;
+        using NeighborRange = std::ranges::subrange<Impl::LiveEdgeIterator<typename AdjList::const_iterator>>;
 
+    private:
+        std::vector<T> m_items;
+        std::vector<AdjList> m_adj;
+        Bitset::DynamicBitset m_removed;
+        std::size_t m_removed_count;
+        [[no_unique_address]] Impl::ItemLookup<L, T> m_lookup;
+        [[no_unique_address]] EdgeAllocator m_allocator;
+
+        [[nodiscard]] PosOpt indexOfItem(const T& item) const noexcept {
+            return m_lookup.find(m_items, m_removed, item);
+        }
+
+    public:
+        Graph() requires (std::default_initializable<EdgeAllocator>)
+        : m_items {}, m_adj {}, m_removed {}, m_removed_count {0}, m_lookup {}, m_allocator {} {}
+
+        explicit Graph(const EdgeAllocator& allocator)
+        : m_items {}, m_adj {}, m_removed {}, m_removed_count {0}, m_lookup {}, m_allocator {allocator} {}
+
+        /**
+         * @brief Gives the bound of node indices, which counts tombstoned slots until the next `compact()`. See `liveCount()` for the number of present nodes.
+         */
         [[nodiscard]] std::size_t size() const noexcept {
             return m_items.size();
         }
 
+        [[nodiscard]] std::size_t liveCount() const noexcept {
+            return m_items.size() - m_removed_count;
+        }
+
+        [[nodiscard]] std::size_t tombstoneCount() const noexcept {
+            return m_removed_count;
+        }
+
+        [[nodiscard]] bool isRemoved(int index) const noexcept {
+            return m_removed.test(index);
+        }
+
         T& first() & noexcept {
             return m_items[0];
         }
@@ -70,14 +547,24 @@ namespace DerkLib::Containers::Graph {
             return m_items[0];
         }
 
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            return indexOfItem(item);
+        }
+
         template <typename T2 = T>
         [[maybe_unused]] bool add(T2&& arg) {
-            if (std::find(m_items.cbegin(), m_items.cend(), arg) != m_items.cend()) {
+            if (indexOfItem(arg)) {
                 return false;
             }
 
-            m_items.emplace_back(arg);
-            m_adj.emplace_back(AdjList {});
+            m_items.emplace_back(std::forward<T2>(arg));
+            m_adj.emplace_back(m_allocator);
+            m_removed.resize(m_items.size());
+            m_lookup.insert(m_items.back(), static_cast<int>(m_items.size()) - 1);
 
             return true;
         }
@@ -90,13 +577,20 @@ namespace DerkLib::Containers::Graph {
                 return false;
             }
 
-            m_adj[from_index.value()].emplace_front(to_index.value());
+            connectAt(from_index.value(), to_index.value(), flag);
+
+            return true;
+        }
+
+        /**
+         * @brief Index-based `connect` for callers that already hold node indices, skipping both item lookups. Indices must be in `[0, size())`.
+         */
+        void connectAt(int from_index, int to_index, DirectFlag flag) {
+            m_adj[from_index].emplace_front(to_index);
 
             if (flag == DirectFlag::two_way) {
-                m_adj[to_index.value()].emplace_front(from_index.value());
+                m_adj[to_index].emplace_front(from_index);
             }
-
-            return true;
         }
 
         bool remove(const T& target) {
@@ -106,12 +600,133 @@ namespace DerkLib::Containers::Graph {
                 return false;
             }
 
-            m_items.erase(m_items.begin() + target_index.value());
-            m_adj.erase(m_adj.begin() + target_index.value());
+            return removeAt(target_index.value());
+        }
+
+        /**
+         * @brief Tombstones the node at `index` in O(out-degree): its out-edges are dropped and edges into it are skipped by `neighbors` until `compact()` purges them. Other nodes keep their indices.
+         * 
+         * @return false if the node was already removed
+         */
+        bool removeAt(int index) {
+            if (m_removed.testAndSet(index)) {
+                return false;
+            }
+
+            ++m_removed_count;
+            m_adj[index].clear();
+            m_lookup.erase(m_items[index]);
 
             return true;
         }
 
+        /**
+         * @brief Purges tombstones in one linear sweep. Live nodes are renumbered in their current order, and each adjacency list drops edges into removed nodes and is rewritten to the new indices.
+         * 
+         * @return std::vector<int> the new index of each old index, or -1 for removed nodes
+         */
+        std::vector<int> compact() {
+            const auto slot_count = static_cast<int>(m_items.size());
+            std::vector<int> new_indices (slot_count, -1);
+            auto live_count = 0;
+
+            for (auto index = 0; index < slot_count; index++) {
+                if (not m_removed.test(index)) {
+                    new_indices[index] = live_count++;
+                }
+            }
+
+            if (m_removed_count == 0) {
+                return new_indices;
+            }
+
+            std::vector<T> live_items;
+            std::vector<AdjList> live_adj;
+
+            live_items.reserve(live_count);
+            live_adj.reserve(live_count);
+
+            for (auto index = 0; index < slot_count; index++) {
+                if (m_removed.test(index)) {
+                    continue;
+                }
+
+                auto& neighbor_list = m_adj[index];
+
+                neighbor_list.remove_if([&new_indices](const auto& edge) noexcept {
+                    return new_indices[destinationOf(edge)] < 0;
+                });
+
+                for (auto& edge : neighbor_list) {
+                    edge = new_indices[edge];
+                }
+
+                live_items.emplace_back(std::move(m_items[index]));
+                live_adj.emplace_back(std::move(neighbor_list));
+            }
+
+            m_items = std::move(live_items);
+            m_adj = std::move(live_adj);
+            m_removed = Bitset::DynamicBitset (m_items.size());
+            m_removed_count = 0;
+            m_lookup.rebuild(m_items, m_removed);
+
+            return new_indices;
+        }
+
+        /**
+         * @brief Renumbers every node slot, tombstones included, so the node at old index `i` lands at `new_indices[i]`. Items & adjacency lists are moved rather than copied, and edge destinations are rewritten in place.
+         * 
+         * @param new_indices a permutation of `[0, size())`, such as one from `algorithms/reordering.hpp`
+         */
+        void permute(std::span<const int> new_indices) {
+            const auto slot_count = static_cast<int>(m_items.size());
+            std::vector<int> old_indices (slot_count);
+            std::vector<T> permuted_items;
+            std::vector<AdjList> permuted_adj;
+            Bitset::DynamicBitset permuted_removed (m_items.size());
+
+            for (auto index = 0; index < slot_count; index++) {
+                old_indices[new_indices[index]] = index;
+            }
+
+            permuted_items.reserve(slot_count);
+            permuted_adj.reserve(slot_count);
+
+            for (auto new_index = 0; new_index < slot_count; new_index++) {
+                const auto old_index = old_indices[new_index];
+                auto& neighbor_list = m_adj[old_index];
+
+                for (auto& edge : neighbor_list) {
+                    edge = new_indices[edge];
+                }
+
+                if (m_removed.test(old_index)) {
+                    permuted_removed.set(new_index);
+                }
+
+                permuted_items.emplace_back(std::move(m_items[old_index]));
+                permuted_adj.emplace_back(std::move(neighbor_list));
+            }
+
+            m_items = std::move(permuted_items);
+            m_adj = std::move(permuted_adj);
+            m_removed = std::move(permuted_removed);
+            m_lookup.rebuild(m_items, m_removed);
+        }
+
+        /**
+         * @brief Lazily walks the adjacency of the node at `index` without allocating, skipping edges into removed nodes. The view stays valid until the graph is next modified.
+         */
+        [[nodiscard]] NeighborRange neighbors(int index) const& noexcept {
+            const auto* removed = (m_removed_count > 0) ? &m_removed : nullptr;
+
+            return {
+                Impl::LiveEdgeIterator {m_adj[index].cbegin(), m_adj[index].cend(), removed},
+                Impl::LiveEdgeIterator {m_adj[index].cend(), m_adj[index].cend(), removed}
+            };
+        }
+
         [[nodiscard]] std::vector<ItemPtr> neighborsOf(const T& arg) const& {
             auto target_index = indexOfItem(arg);
 
@@ -119,15 +734,41 @@ namespace DerkLib::Containers::Graph {
                 return {};
             }
 
-            const auto& neighbor_list = m_adj.at(target_index.value());
             std::vector<ItemPtr> result;
 
-            for (const auto neighbor_position : neighbor_list) {
-                result.emplace_back(m_items.data() + neighbor_position);
+            for (const auto& neighbor_edge : neighbors(target_index.value())) {
+                result.emplace_back(m_items.data() + destinationOf(neighbor_edge));
             }
 
             return result;
         }
+
+        /**
+         * @brief Packs this graph into an immutable `CsrGraph` whose neighbor runs keep the same order as `neighborsOf`. Tombstoned slots carry over as isolated nodes, so call `compact()` first for a dense snapshot.
+         * 
+         * @return CsrGraph<PathPolicy::unweighted, T> 
+         */
+        [[nodiscard]] CsrGraph<PathPolicy::unweighted, T> freeze() const {
+            std::vector<int> offsets;
+            std::vector<int> targets;
+
+            offsets.reserve(m_adj.size() + 1);
+            offsets.emplace_back(0);
+
+            for (auto index = 0; index < static_cast<int>(m_adj.size()); index++) {
+                offsets.emplace_back(offsets.back() + static_cast<int>(std::ranges::distance(neighbors(index))));
+            }
+
+            targets.reserve(offsets.back());
+
+            for (auto index = 0; index < static_cast<int>(m_adj.size()); index++) {
+                for (const auto destination : neighbors(index)) {
+                    targets.emplace_back(destination);
+                }
+            }
+
+            return {m_items, std::move(offsets), std::move(targets)};
+        }
     };
 
     /**
@@ -135,42 +776,52 @@ namespace DerkLib::Containers::Graph {
      * 
      * @tparam T 
      */
-    template <typename T>
-    class Graph <PathPolicy::weighted, T> {
+    template <typename T, LookupPolicy L, template <typename> typename Alloc, typename W>
+    class Graph <PathPolicy::weighted, T, L, Alloc, W> {
     public:
-        using WeightedEdge = std::pair<int, int>; // <cost, destination-index>
-        using AdjList = std::forward_list<WeightedEdge>;
+        using WeightedEdge = WeightedEdgeOf<W>;
+        using EdgeAllocator = Alloc<WeightedEdge>;
+        using AdjList = std::forward_list<WeightedEdge, EdgeAllocator>;
         using PosOpt = std::optional<int>;
         using ItemPtr = const T*;
+        using NeighborRange = std::ranges::subrange<Impl::LiveEdgeIterator<typename AdjList::const_iterator>>;
 
     private:
         std::vector<T> m_items;
         std::vector<AdjList> m_adj;
+        Bitset::DynamicBitset m_removed;
+        std::size_t m_removed_count;
+        [[no_unique_address]] Impl::ItemLookup<L, T> m_lookup;
+        [[no_unique_address]] EdgeAllocator m_allocator;
 
         [[nodiscard]] PosOpt indexOfItem(const T& item) const noexcept {
-            auto index = 0;
+            return m_lookup.find(m_items, m_removed, item);
+        }
 
-            for (const auto& temp : m_items) {
-                if (item == temp) {
-                    return index;
-                }
+    public:
+        Graph() requires (std::default_initializable<EdgeAllocator>)
+        : m_items {}, m_adj {}, m_removed {}, m_removed_count {0}, m_lookup {}, m_allocator {} {}
 
-                ++index;
-            }
+        explicit Graph(const EdgeAllocator& allocator)
+        : m_items {}, m_adj {}, m_removed {}, m_removed_count {0}, m_lookup {}, m_allocator {allocator} {}
 
-            if (static_cast<std::size_t>(index) < m_items.size()) {
-                return index;
-            }
+        /**
+         * @brief Gives the bound of node indices, which counts tombstoned slots until the next `compact()`. See `liveCount()` for the number of present nodes.
+         */
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_items.size();
+        }
 
-            return {};
+        [[nodiscard]] std::size_t liveCount() const noexcept {
+            return m_items.size() - m_removed_count;
         }
 
-    public:
-        Graph()
-        : m_items {}, m_adj {} {}
+        [[nodiscard]] std::size_t tombstoneCount() const noexcept {
+            return m_removed_count;
+        }
 
-        [[nodiscard]] std::size_t size() const noexcept {
-            return m_items.size();
+        [[nodiscard]] bool isRemoved(int index) const noexcept {
+            return m_removed.test(index);
         }
 
         T& first() & noexcept {
@@ -181,19 +832,29 @@ namespace DerkLib::Containers::Graph {
             return m_items[0];
         }
 
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            return indexOfItem(item);
+        }
+
         template <typename T2 = T>
         [[maybe_unused]] bool add(T2&& arg) {
-            if (std::find(m_items.cbegin(), m_items.cend(), arg) != m_items.cend()) {
+            if (indexOfItem(arg)) {
                 return false;
             }
 
-            m_items.emplace_back(arg);
-            m_adj.emplace_back(AdjList {});
+            m_items.emplace_back(std::forward<T2>(arg));
+            m_adj.emplace_back(m_allocator);
+            m_removed.resize(m_items.size());
+            m_lookup.insert(m_items.back(), static_cast<int>(m_items.size()) - 1);
 
             return true;
         }
 
-        [[nodiscard]] bool connect(const T& from, const T& to, int cost, DirectFlag flag) {
+        [[nodiscard]] bool connect(const T& from, const T& to, W cost, DirectFlag flag) {
             PosOpt from_index = indexOfItem(from);
             PosOpt to_index = indexOfItem(to);
 
@@ -201,13 +862,20 @@ namespace DerkLib::Containers::Graph {
                 return false;
             }
 
-            m_adj[from_index.value()].emplace_front(cost, to_index.value());
+            connectAt(from_index.value(), to_index.value(), cost, flag);
+
+            return true;
+        }
+
+        /**
+         * @brief Index-based `connect` for callers that already hold node indices, skipping both item lookups. Indices must be in `[0, size())`.
+         */
+        void connectAt(int from_index, int to_index, W cost, DirectFlag flag) {
+            m_adj[from_index].emplace_front(cost, to_index);
 
             if (flag == DirectFlag::two_way) {
-                m_adj[to_index.value()].emplace_front(cost, from_index.value());
+                m_adj[to_index].emplace_front(cost, from_index);
             }
-
-            return true;
         }
 
         bool remove(const T& target) {
@@ -217,12 +885,133 @@ namespace DerkLib::Containers::Graph {
                 return false;
             }
 
-            m_items.erase(m_items.begin() + target_index.value());
-            m_adj.erase(m_adj.begin() + target_index.value());
+            return removeAt(target_index.value());
+        }
+
+        /**
+         * @brief Tombstones the node at `index` in O(out-degree): its out-edges are dropped and edges into it are skipped by `neighbors` until `compact()` purges them. Other nodes keep their indices.
+         * 
+         * @return false if the node was already removed
+         */
+        bool removeAt(int index) {
+            if (m_removed.testAndSet(index)) {
+                return false;
+            }
+
+            ++m_removed_count;
+            m_adj[index].clear();
+            m_lookup.erase(m_items[index]);
 
             return true;
         }
 
+        /**
+         * @brief Purges tombstones in one linear sweep. Live nodes are renumbered in their current order, and each adjacency list drops edges into removed nodes and is rewritten to the new indices.
+         * 
+         * @return std::vector<int> the new index of each old index, or -1 for removed nodes
+         */
+        std::vector<int> compact() {
+            const auto slot_count = static_cast<int>(m_items.size());
+            std::vector<int> new_indices (slot_count, -1);
+            auto live_count = 0;
+
+            for (auto index = 0; index < slot_count; index++) {
+                if (not m_removed.test(index)) {
+                    new_indices[index] = live_count++;
+                }
+            }
+
+            if (m_removed_count == 0) {
+                return new_indices;
+            }
+
+            std::vector<T> live_items;
+            std::vector<AdjList> live_adj;
+
+            live_items.reserve(live_count);
+            live_adj.reserve(live_count);
+
+            for (auto index = 0; index < slot_count; index++) {
+                if (m_removed.test(index)) {
+                    continue;
+                }
+
+                auto& neighbor_list = m_adj[index];
+
+                neighbor_list.remove_if([&new_indices](const auto& edge) noexcept {
+                    return new_indices[destinationOf(edge)] < 0;
+                });
+
+                for (auto& edge : neighbor_list) {
+                    edge.second = new_indices[edge.second];
+                }
+
+                live_items.emplace_back(std::move(m_items[index]));
+                live_adj.emplace_back(std::move(neighbor_list));
+            }
+
+            m_items = std::move(live_items);
+            m_adj = std::move(live_adj);
+            m_removed = Bitset::DynamicBitset (m_items.size());
+            m_removed_count = 0;
+            m_lookup.rebuild(m_items, m_removed);
+
+            return new_indices;
+        }
+
+        /**
+         * @brief Renumbers every node slot, tombstones included, so the node at old index `i` lands at `new_indices[i]`. Items & adjacency lists are moved rather than copied, and edge destinations are rewritten in place.
+         * 
+         * @param new_indices a permutation of `[0, size())`, such as one from `algorithms/reordering.hpp`
+         */
+        void permute(std::span<const int> new_indices) {
+            const auto slot_count = static_cast<int>(m_items.size());
+            std::vector<int> old_indices (slot_count);
+            std::vector<T> permuted_items;
+            std::vector<AdjList> permuted_adj;
+            Bitset::DynamicBitset permuted_removed (m_items.size());
+
+            for (auto index = 0; index < slot_count; index++) {
+                old_indices[new_indices[index]] = index;
+            }
+
+            permuted_items.reserve(slot_count);
+            permuted_adj.reserve(slot_count);
+
+            for (auto new_index = 0; new_index < slot_count; new_index++) {
+                const auto old_index = old_indices[new_index];
+                auto& neighbor_list = m_adj[old_index];
+
+                for (auto& edge : neighbor_list) {
+                    edge.second = new_indices[edge.second];
+                }
+
+                if (m_removed.test(old_index)) {
+                    permuted_removed.set(new_index);
+                }
+
+                permuted_items.emplace_back(std::move(m_items[old_index]));
+                permuted_adj.emplace_back(std::move(neighbor_list));
+            }
+
+            m_items = std::move(permuted_items);
+            m_adj = std::move(permuted_adj);
+            m_removed = std::move(permuted_removed);
+            m_lookup.rebuild(m_items, m_removed);
+        }
+
+        /**
+         * @brief Lazily walks the adjacency of the node at `index` without allocating, skipping edges into removed nodes. The view stays valid until the graph is next modified.
+         */
+        [[nodiscard]] NeighborRange neighbors(int index) const& noexcept {
+            const auto* removed = (m_removed_count > 0) ? &m_removed : nullptr;
+
+            return {
+                Impl::LiveEdgeIterator {m_adj[index].cbegin(), m_adj[index].cend(), removed},
+                Impl::LiveEdgeIterator {m_adj[index].cend(), m_adj[index].cend(), removed}
+            };
+        }
+
         [[nodiscard]] std::vector<ItemPtr> neighborsOf(const T& arg) const& {
             auto target_index = indexOfItem(arg);
 
@@ -230,14 +1019,244 @@ namespace DerkLib::Containers::Graph {
                 return {};
             }
 
-            const auto& neighbor_list = m_adj.at(target_index.value());
             std::vector<ItemPtr> result;
 
-            for (const auto neighbor_position : neighbor_list) {
-                result.emplace_back(m_items.data() + neighbor_position);
+            for (const auto& neighbor_edge : neighbors(target_index.value())) {
+                result.emplace_back(m_items.data() + destinationOf(neighbor_edge));
             }
 
             return result;
         }
+
+        /**
+         * @brief Packs this graph into an immutable `CsrGraph` whose neighbor runs keep the same order as `neighborsOf`. Tombstoned slots carry over as isolated nodes, so call `compact()` first for a dense snapshot.
+         * 
+         * @return CsrGraph<PathPolicy::weighted, T, W> 
+         */
+        [[nodiscard]] CsrGraph<PathPolicy::weighted, T, W> freeze() const {
+            std::vector<int> offsets;
+            std::vector<int> targets;
+            std::vector<W> costs;
+
+            offsets.reserve(m_adj.size() + 1);
+            offsets.emplace_back(0);
+
+            for (auto index = 0; index < static_cast<int>(m_adj.size()); index++) {
+                offsets.emplace_back(offsets.back() + static_cast<int>(std::ranges::distance(neighbors(index))));
+            }
+
+            targets.reserve(offsets.back());
+            costs.reserve(offsets.back());
+
+            for (auto index = 0; index < static_cast<int>(m_adj.size()); index++) {
+                for (const auto& [cost, destination] : neighbors(index)) {
+                    targets.emplace_back(destination);
+                    costs.emplace_back(cost);
+                }
+            }
+
+            return {m_items, std::move(offsets), std::move(targets), std::move(costs)};
+        }
     };
+
+    /**
+     * @brief Builds the reverse adjacency of any indexed graph as a `CsrGraph` with the same items, so each node's run lists its in-neighbors in ascending index order. Edge costs carry over for weighted graphs.
+     * 
+     * @tparam G 
+     * @param arg 
+     */
+    template <typename G> requires (Meta::Graphs::IndexedGraphKind<G>)
+    [[nodiscard]] auto transposeOf(const G& arg) {
+        using Item = Meta::Graphs::GraphItemOf<G>;
+        using Cost = Meta::Graphs::GraphCostOf<G>;
+        constexpr auto is_weighted = Meta::Graphs::WeightedGraphKind<G>;
+
+        const auto node_count = static_cast<int>(arg.size());
+        std::vector<Item> items;
+        std::vector<int> offsets (node_count + 1, 0);
+
+        items.reserve(node_count);
+
+        for (auto node = 0; node < node_count; node++) {
+            items.emplace_back(arg.itemAt(node));
+
+            for (const auto& edge : arg.neighbors(node)) {
+                ++offsets[destinationOf(edge) + 1];
+            }
+        }
+
+        for (auto node = 0; node < node_count; node++) {
+            offsets[node + 1] += offsets[node];
+        }
+
+        std::vector<int> cursors (offsets.cbegin(), offsets.cend() - 1);
+        std::vector<int> targets (offsets.back());
+        std::vector<Cost> costs (is_weighted ? offsets.back() : 0);
+
+        for (auto node = 0; node < node_count; node++) {
+            for (const auto& edge : arg.neighbors(node)) {
+                const auto slot = cursors[destinationOf(edge)]++;
+
+                targets[slot] = node;
+
+                if constexpr (is_weighted) {
+                    costs[slot] = edge.first;
+                }
+            }
+        }
+
+        if constexpr (is_weighted) {
+            return CsrGraph<PathPolicy::weighted, Item, Cost> {std::move(items), std::move(offsets), std::move(targets), std::move(costs)};
+        } else {
+            return CsrGraph<PathPolicy::unweighted, Item> {std::move(items), std::move(offsets), std::move(targets)};
+        }
+    }
+
+    /**
+     * @brief Bulk-builds a `CsrGraph` from `nodes` & an edge list in a few linear passes, with no per-edge lookups or allocations. The passes count degrees, prefix-sum them into offsets and scatter the edges. Then, if requested, each neighbor run is sorted and deduplicated across `options.thread_count` workers. Edges name nodes by their position in `nodes`. Passing `IndexCostEdgeOf<W>`s builds a weighted graph with `W` costs, and deduplication then keeps the cheapest parallel edge.
+     * 
+     * @param nodes span of node items, e.g. `std::span {node_vector}`
+     * @param edges span of `IndexEdge` or `IndexCostEdgeOf<W>` tuples
+     * @param options 
+     * @return std::optional<CsrGraph<...>> empty if any edge names a node outside `nodes`
+     */
+    template <typename NodeItem, typename Edge> requires (std::same_as<std::remove_const_t<Edge>, IndexEdge> or IndexCostEdgeKind<std::remove_const_t<Edge>>)
+    [[nodiscard]] auto buildCsrGraph(std::span<NodeItem> nodes, std::span<Edge> edges, CsrBuildOptions options = {}) {
+        using T = std::remove_const_t<NodeItem>;
+
+        constexpr auto is_weighted = IndexCostEdgeKind<std::remove_const_t<Edge>>;
+        constexpr auto graph_policy = is_weighted ? PathPolicy::weighted : PathPolicy::unweighted;
+
+        using Cost = std::tuple_element_t<is_weighted ? 2 : 1, std::remove_const_t<Edge>>;
+        using Result = std::optional<CsrGraph<graph_policy, T, Cost>>;
+
+        const auto node_count = static_cast<int>(nodes.size());
+        const auto two_way = options.direction == DirectFlag::two_way;
+        std::vector<int> offsets (node_count + 1, 0);
+
+        for (const auto& edge : edges) {
+            const auto from = std::get<0>(edge);
+            const auto to = std::get<1>(edge);
+
+            if (from < 0 or from >= node_count or to < 0 or to >= node_count) {
+                return Result {};
+            }
+
+            ++offsets[from + 1];
+
+            if (two_way) {
+                ++offsets[to + 1];
+            }
+        }
+
+        for (auto node = 0; node < node_count; node++) {
+            offsets[node + 1] += offsets[node];
+        }
+
+        std::vector<int> cursors (offsets.cbegin(), offsets.cend() - 1);
+        std::vector<int> targets (offsets.back());
+        std::vector<Cost> costs (is_weighted ? offsets.back() : 0);
+
+        auto scatter = [&](int from, int to, [[maybe_unused]] Cost cost) noexcept {
+            const auto slot = cursors[from]++;
+
+            targets[slot] = to;
+
+            if constexpr (is_weighted) {
+                costs[slot] = cost;
+            }
+        };
+
+        for (const auto& edge : edges) {
+            const auto cost = [&edge]() noexcept {
+                if constexpr (is_weighted) {
+                    return std::get<2>(edge);
+                } else {
+                    return Cost {};
+                }
+            }();
+
+            scatter(std::get<0>(edge), std::get<1>(edge), cost);
+
+            if (two_way) {
+                scatter(std::get<1>(edge), std::get<0>(edge), cost);
+            }
+        }
+
+        if (options.sort_neighbors or options.deduplicate) {
+            std::vector<int> run_sizes (node_count, 0);
+
+            Impl::forEachNodeBlock(offsets, options.thread_count, [&](int first_node, int last_node) {
+                std::vector<std::pair<int, Cost>> run_edges; // <destination, cost>
+
+                for (auto node = first_node; node < last_node; node++) {
+                    const auto run_begin = offsets[node];
+                    const auto run_end = offsets[node + 1];
+
+                    if constexpr (is_weighted) {
+                        run_edges.clear();
+
+                        for (auto slot = run_begin; slot < run_end; slot++) {
+                            run_edges.emplace_back(targets[slot], costs[slot]);
+                        }
+
+                        std::sort(run_edges.begin(), run_edges.end());
+
+                        if (options.deduplicate) {
+                            run_edges.erase(std::unique(run_edges.begin(), run_edges.end(), [](const auto& lhs, const auto& rhs) noexcept {
+                                return lhs.first == rhs.first;
+                            }), run_edges.end());
+                        }
+
+                        for (auto slot = run_begin; const auto& [destination, cost] : run_edges) {
+                            targets[slot] = destination;
+                            costs[slot] = cost;
+                            ++slot;
+                        }
+
+                        run_sizes[node] = static_cast<int>(run_edges.size());
+                    } else {
+                        std::sort(targets.begin() + run_begin, targets.begin() + run_end);
+
+                        run_sizes[node] = options.deduplicate
+                            ? static_cast<int>(std::unique(targets.begin() + run_begin, targets.begin() + run_end) - (targets.begin() + run_begin))
+                            : run_end - run_begin;
+                    }
+                }
+            });
+
+            if (options.deduplicate) {
+                std::vector<int> packed_offsets (node_count + 1, 0);
+
+                for (auto node = 0; node < node_count; node++) {
+                    packed_offsets[node + 1] = packed_offsets[node] + run_sizes[node];
+                }
+
+                std::vector<int> packed_targets (packed_offsets.back());
+                std::vector<Cost> packed_costs (is_weighted ? packed_offsets.back() : 0);
+
+                Impl::forEachNodeBlock(offsets, options.thread_count, [&](int first_node, int last_node) {
+                    for (auto node = first_node; node < last_node; node++) {
+                        std::copy_n(targets.cbegin() + offsets[node], run_sizes[node], packed_targets.begin() + packed_offsets[node]);
+
+                        if constexpr (is_weighted) {
+                            std::copy_n(costs.cbegin() + offsets[node], run_sizes[node], packed_costs.begin() + packed_offsets[node]);
+                        }
+                    }
+                });
+
+                offsets = std::move(packed_offsets);
+                targets = std::move(packed_targets);
+                costs = std::move(packed_costs);
+            }
+        }
+
+        std::vector<T> items (nodes.begin(), nodes.end());
+
+        if constexpr (is_weighted) {
+            return Result {CsrGraph<graph_policy, T, Cost> {std::move(items), std::move(offsets), std::move(targets), std::move(costs)}};
+        } else {
+            return Result {CsrGraph<graph_policy, T, Cost> {std::move(items), std::move(offsets), std::move(targets)}};
+        }
+    }
 }
\ No newline at end of file
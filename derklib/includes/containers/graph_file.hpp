@@ -0,0 +1,306 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "containers/graph.hpp"
+
+namespace DerkLib::Containers::Graph {
+    /**
+     * @brief Fixed header at the start of a binary graph file. The offsets, targets, costs & items sections follow it as raw native-endian arrays, each starting at a 64-byte aligned file offset recorded here. Offsets & targets are `int32`, costs are `int32` and only present for weighted graphs, and items are raw `T` bytes.
+     */
+    struct GraphFileHeader {
+        static constexpr std::uint64_t expected_magic = 0x314652474B524544ULL; // "DERKGRF1" in little-endian byte order
+        static constexpr std::uint32_t expected_version = 1;
+        static constexpr std::uint32_t expected_byte_order = 0x01020304U;
+        static constexpr std::uint64_t section_alignment = 64;
+
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        std::uint32_t path_policy;
+        std::uint32_t item_size;
+        std::uint64_t node_count;
+        std::uint64_t edge_count;
+        std::uint64_t offsets_at;
+        std::uint64_t targets_at;
+        std::uint64_t costs_at;
+        std::uint64_t items_at;
+        std::uint64_t file_size;
+    };
+
+    static_assert(std::is_trivially_copyable_v<GraphFileHeader> and sizeof(GraphFileHeader) == 80);
+
+    namespace Impl {
+        [[nodiscard]] constexpr std::uint64_t alignSection(std::uint64_t position) noexcept {
+            return (position + GraphFileHeader::section_alignment - 1) / GraphFileHeader::section_alignment * GraphFileHeader::section_alignment;
+        }
+
+        template <typename Element>
+        void writeSection(std::ofstream& writer, std::uint64_t at, std::span<const Element> elements) {
+            const auto position = static_cast<std::uint64_t>(writer.tellp());
+            static constexpr char padding[GraphFileHeader::section_alignment] {};
+
+            writer.write(padding, static_cast<std::streamsize>(at - position));
+            writer.write(reinterpret_cast<const char*>(elements.data()), static_cast<std::streamsize>(elements.size_bytes()));
+        }
+    }
+
+    /**
+     * @brief Writes a `CsrGraph` in the binary layout described by `GraphFileHeader`, so `MappedGraph` can later map it without parsing.
+     * 
+     * @tparam P 
+     * @tparam T trivially copyable item type
+     * @param arg 
+     * @param file_path 
+     * @return true on a complete write
+     */
+    template <PathPolicy P, typename T> requires (std::is_trivially_copyable_v<T>)
+    [[nodiscard]] bool saveGraphFile(const CsrGraph<P, T>& arg, const std::filesystem::path& file_path) {
+        const auto node_count = static_cast<std::uint64_t>(arg.size());
+        const auto edge_count = static_cast<std::uint64_t>(arg.edgeCount());
+
+        GraphFileHeader header {
+            .magic = GraphFileHeader::expected_magic,
+            .version = GraphFileHeader::expected_version,
+            .byte_order = GraphFileHeader::expected_byte_order,
+            .path_policy = static_cast<std::uint32_t>(P),
+            .item_size = static_cast<std::uint32_t>(sizeof(T)),
+            .node_count = node_count,
+            .edge_count = edge_count,
+            .offsets_at = Impl::alignSection(sizeof(GraphFileHeader)),
+            .targets_at = 0,
+            .costs_at = 0,
+            .items_at = 0,
+            .file_size = 0
+        };
+
+        header.targets_at = Impl::alignSection(header.offsets_at + (node_count + 1) * sizeof(int));
+        header.costs_at = Impl::alignSection(header.targets_at + edge_count * sizeof(int));
+        header.items_at = Impl::alignSection(header.costs_at + ((P == PathPolicy::weighted) ? edge_count * sizeof(int) : 0));
+        header.file_size = header.items_at + node_count * sizeof(T);
+
+        std::ofstream writer {file_path, std::ios::binary | std::ios::trunc};
+
+        if (not writer) {
+            return false;
+        }
+
+        writer.write(reinterpret_cast<const char*>(&header), sizeof(GraphFileHeader));
+        Impl::writeSection(writer, header.offsets_at, arg.offsets());
+        Impl::writeSection(writer, header.targets_at, arg.targets());
+
+        if constexpr (P == PathPolicy::weighted) {
+            Impl::writeSection(writer, header.costs_at, arg.costs());
+        }
+
+        Impl::writeSection(writer, header.items_at, arg.items());
+        writer.flush();
+
+        return static_cast<bool>(writer);
+    }
+
+    /**
+     * @brief Read-only, memory-mapped view of a binary graph file written by `saveGraphFile`. Opening validates only the header & section bounds, so startup is O(1) regardless of graph size, and pages fault in on first use and are shared through the page cache across processes. It offers the same index API as `CsrGraph`, so traversal & path algorithms run directly on the mapped pages.
+     * 
+     * @tparam P 
+     * @tparam T trivially copyable item type matching the one saved
+     */
+    template <PathPolicy P, typename T> requires (std::is_trivially_copyable_v<T>)
+    class MappedGraph {
+    public:
+        using PosOpt = std::optional<int>;
+
+    private:
+        void* m_base;
+        std::size_t m_length;
+        std::span<const int> m_offsets;
+        std::span<const int> m_targets;
+        std::span<const int> m_costs;
+        std::span<const T> m_items;
+
+        MappedGraph(void* base, std::size_t length, const GraphFileHeader& header) noexcept
+        : m_base {base}, m_length {length}, m_offsets {}, m_targets {}, m_costs {}, m_items {} {
+            const auto* bytes = static_cast<const unsigned char*>(base);
+
+            m_offsets = {reinterpret_cast<const int*>(bytes + header.offsets_at), header.node_count + 1};
+            m_targets = {reinterpret_cast<const int*>(bytes + header.targets_at), header.edge_count};
+            m_items = {reinterpret_cast<const T*>(bytes + header.items_at), header.node_count};
+
+            if constexpr (P == PathPolicy::weighted) {
+                m_costs = {reinterpret_cast<const int*>(bytes + header.costs_at), header.edge_count};
+            }
+        }
+
+        void release() noexcept {
+            if (m_base != nullptr) {
+                ::munmap(m_base, m_length);
+                m_base = nullptr;
+                m_length = 0;
+            }
+        }
+
+        /// NOTE: `at` comes from the file, so it is bounded before anything is added to it & the sum cannot wrap.
+        [[nodiscard]] static bool fitsBefore(std::uint64_t at, std::uint64_t section_size, std::uint64_t limit) noexcept {
+            return at <= limit and section_size <= limit - at;
+        }
+
+        [[nodiscard]] static bool isHeaderValid(const GraphFileHeader& header, std::size_t length) noexcept {
+            const auto weighted_section = (P == PathPolicy::weighted) ? header.edge_count * sizeof(int) : 0;
+
+            return header.magic == GraphFileHeader::expected_magic
+                and header.version == GraphFileHeader::expected_version
+                and header.byte_order == GraphFileHeader::expected_byte_order
+                and header.path_policy == static_cast<std::uint32_t>(P)
+                and header.item_size == sizeof(T)
+                and header.file_size == length
+                and header.offsets_at >= sizeof(GraphFileHeader)
+                and header.node_count < static_cast<std::uint64_t>(std::numeric_limits<int>::max())
+                and header.edge_count <= static_cast<std::uint64_t>(std::numeric_limits<int>::max())
+                and header.offsets_at % alignof(int) == 0 and header.targets_at % alignof(int) == 0
+                and header.costs_at % alignof(int) == 0 and header.items_at % alignof(T) == 0
+                and fitsBefore(header.offsets_at, (header.node_count + 1) * sizeof(int), header.targets_at)
+                and fitsBefore(header.targets_at, header.edge_count * sizeof(int), header.costs_at)
+                and fitsBefore(header.costs_at, weighted_section, header.items_at)
+                and fitsBefore(header.items_at, header.node_count * sizeof(T), length);
+        }
+
+        /// NOTE: an O(V + E) pass over the mapped body, so a crafted file cannot send `neighbors` or the algorithms taking this graph out of bounds: offsets run from 0 up to `edge_count` without decreasing, & every target is a valid node index.
+        [[nodiscard]] bool isBodyValid() const noexcept {
+            const auto node_count_n = static_cast<int>(m_items.size());
+
+            return m_offsets.front() == 0
+                and static_cast<std::size_t>(m_offsets.back()) == m_targets.size()
+                and std::ranges::is_sorted(m_offsets)
+                and std::ranges::all_of(m_targets, [node_count_n](int target) noexcept { return target >= 0 and target < node_count_n; });
+        }
+
+    public:
+        /**
+         * @brief Maps `file_path` read-only. The file is untrusted: the header is bounds-checked against the file length, and the offsets & targets sections are scanned once, so opening costs O(V + E). Items & costs are taken as stored.
+         * 
+         * @param file_path 
+         * @return std::optional<MappedGraph> empty if the file is missing, unmappable, its header does not match `P`, `T` & this platform, or its offsets or targets are out of range
+         */
+        [[nodiscard]] static std::optional<MappedGraph> open(const std::filesystem::path& file_path) {
+            const auto file_fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+
+            if (file_fd < 0) {
+                return {};
+            }
+
+            struct stat file_info {};
+
+            if (::fstat(file_fd, &file_info) != 0 or static_cast<std::size_t>(file_info.st_size) < sizeof(GraphFileHeader)) {
+                ::close(file_fd);
+                return {};
+            }
+
+            const auto length = static_cast<std::size_t>(file_info.st_size);
+            void* base = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, file_fd, 0);
+
+            ::close(file_fd);
+
+            if (base == MAP_FAILED) {
+                return {};
+            }
+
+            GraphFileHeader header {};
+            std::memcpy(&header, base, sizeof(GraphFileHeader));
+
+            if (not isHeaderValid(header, length)) {
+                ::munmap(base, length);
+                return {};
+            }
+
+            MappedGraph mapped {base, length, header};
+
+            if (not mapped.isBodyValid()) {
+                return {};
+            }
+
+            return mapped;
+        }
+
+        MappedGraph(const MappedGraph&) = delete;
+        MappedGraph& operator=(const MappedGraph&) = delete;
+
+        MappedGraph(MappedGraph&& other) noexcept
+        : m_base {std::exchange(other.m_base, nullptr)}, m_length {std::exchange(other.m_length, 0)}, m_offsets {other.m_offsets}, m_targets {other.m_targets}, m_costs {other.m_costs}, m_items {other.m_items} {}
+
+        MappedGraph& operator=(MappedGraph&& other) noexcept {
+            if (&other == this) {
+                return *this;
+            }
+
+            release();
+            m_base = std::exchange(other.m_base, nullptr);
+            m_length = std::exchange(other.m_length, 0);
+            m_offsets = other.m_offsets;
+            m_targets = other.m_targets;
+            m_costs = other.m_costs;
+            m_items = other.m_items;
+
+            return *this;
+        }
+
+        ~MappedGraph() noexcept {
+            release();
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_items.size();
+        }
+
+        [[nodiscard]] std::size_t edgeCount() const noexcept {
+            return m_targets.size();
+        }
+
+        const T& first() const& noexcept {
+            return m_items[0];
+        }
+
+        [[nodiscard]] const T& itemAt(int index) const& noexcept {
+            return m_items[index];
+        }
+
+        [[nodiscard]] PosOpt indexOf(const T& item) const noexcept {
+            if (auto item_it = std::find(m_items.begin(), m_items.end(), item); item_it != m_items.end()) {
+                return static_cast<int>(item_it - m_items.begin());
+            }
+
+            return {};
+        }
+
+        [[nodiscard]] std::span<const int> targetsOf(int index) const& noexcept {
+            return m_targets.subspan(m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+        }
+
+        [[nodiscard]] std::span<const int> costsOf(int index) const& noexcept requires (P == PathPolicy::weighted) {
+            return m_costs.subspan(m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+        }
+
+        [[nodiscard]] auto neighbors(int index) const& noexcept {
+            if constexpr (P == PathPolicy::weighted) {
+                return std::ranges::subrange<Impl::CsrEdgeIterator<int>> {
+                    Impl::CsrEdgeIterator {m_costs.data() + m_offsets[index], m_targets.data() + m_offsets[index]},
+                    Impl::CsrEdgeIterator {m_costs.data() + m_offsets[index + 1], m_targets.data() + m_offsets[index + 1]}
+                };
+            } else {
+                return targetsOf(index);
+            }
+        }
+    };
+}
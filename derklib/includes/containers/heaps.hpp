@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace DerkLib::Containers::Heaps {
+    /**
+     * @brief Min-heap over integer IDs in `[0, capacity)` with O(log_d N) decrease-key. Each slot keeps the key next to its ID, so sift loops compare keys without chasing into a separate key array, and a `d`-way fan-out keeps sibling keys on one cache line.
+     * 
+     * @tparam Key ordered with `operator<`
+     * @tparam Arity children per node (4 by default)
+     */
+    template <typename Key, std::size_t Arity = 4>
+    class IndexedDaryHeap {
+    public:
+        static_assert(Arity >= 2, "IndexedDaryHeap needs an arity of at least 2.");
+
+        struct Entry {
+            Key key;
+            int id;
+        };
+
+        static constexpr int absent = -1;
+
+    private:
+        std::vector<Entry> m_entries;
+        std::vector<int> m_positions;
+
+        void place(std::size_t slot, Entry entry) noexcept {
+            m_positions[entry.id] = static_cast<int>(slot);
+            m_entries[slot] = std::move(entry);
+        }
+
+        void siftUp(std::size_t slot) noexcept {
+            Entry moving = std::move(m_entries[slot]);
+
+            while (slot > 0) {
+                const auto parent = (slot - 1) / Arity;
+
+                if (not (moving.key < m_entries[parent].key)) {
+                    break;
+                }
+
+                place(slot, std::move(m_entries[parent]));
+                slot = parent;
+            }
+
+            place(slot, std::move(moving));
+        }
+
+        void siftDown(std::size_t slot) noexcept {
+            const auto count = m_entries.size();
+            Entry moving = std::move(m_entries[slot]);
+
+            while (true) {
+                const auto first_child = slot * Arity + 1;
+
+                if (first_child >= count) {
+                    break;
+                }
+
+                const auto last_child = std::min(first_child + Arity, count);
+                auto best_child = first_child;
+
+                for (auto child = first_child + 1; child < last_child; child++) {
+                    if (m_entries[child].key < m_entries[best_child].key) {
+                        best_child = child;
+                    }
+                }
+
+                if (not (m_entries[best_child].key < moving.key)) {
+                    break;
+                }
+
+                place(slot, std::move(m_entries[best_child]));
+                slot = best_child;
+            }
+
+            place(slot, std::move(moving));
+        }
+
+    public:
+        IndexedDaryHeap()
+        : m_entries {}, m_positions {} {}
+
+        explicit IndexedDaryHeap(std::size_t capacity)
+        : m_entries {}, m_positions (capacity, absent) {
+            m_entries.reserve(capacity);
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept {
+            return m_entries.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return m_entries.empty();
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept {
+            return m_positions.size();
+        }
+
+        [[nodiscard]] bool contains(int id) const noexcept {
+            return m_positions[id] != absent;
+        }
+
+        [[nodiscard]] const Entry& top() const& noexcept {
+            return m_entries.front();
+        }
+
+        /**
+         * @brief Inserts `id` with `key`, or lowers its key if already queued. Returns whether the heap changed.
+         */
+        bool pushOrDecrease(int id, Key key) {
+            if (const auto slot = m_positions[id]; slot != absent) {
+                if (not (key < m_entries[slot].key)) {
+                    return false;
+                }
+
+                m_entries[slot].key = std::move(key);
+                siftUp(static_cast<std::size_t>(slot));
+
+                return true;
+            }
+
+            m_entries.emplace_back(Entry {std::move(key), id});
+            siftUp(m_entries.size() - 1);
+
+            return true;
+        }
+
+        Entry pop() noexcept {
+            Entry popped = std::move(m_entries.front());
+            m_positions[popped.id] = absent;
+
+            Entry last = std::move(m_entries.back());
+            m_entries.pop_back();
+
+            if (not m_entries.empty()) {
+                place(0, std::move(last));
+                siftDown(0);
+            }
+
+            return popped;
+        }
+
+        /**
+         * @brief Empties the heap in O(size()), leaving capacity untouched for reuse.
+         */
+        void clear() noexcept {
+            for (const auto& entry : m_entries) {
+                m_positions[entry.id] = absent;
+            }
+
+            m_entries.clear();
+        }
+    };
+}
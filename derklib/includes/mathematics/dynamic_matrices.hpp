@@ -0,0 +1,381 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "mathematics/matrices.hpp"
+
+namespace DerkLib::Mathematics::Matrices {
+    namespace Impl {
+        inline constexpr std::size_t matrix_alignment = 64;
+
+        /**
+         * @brief Deleter for the element block of a `DynamicMatrix`, which destroys the `count` elements before freeing the over-aligned storage.
+         *
+         * @tparam T
+         */
+        template <typename T>
+        struct AlignedBlockDeleter {
+            std::size_t count;
+
+            void operator()(T* block) const noexcept {
+                std::destroy_n(block, count);
+                ::operator delete(static_cast<void*>(block), std::align_val_t {matrix_alignment});
+            }
+        };
+
+        template <typename T>
+        using AlignedBlock = std::unique_ptr<T[], AlignedBlockDeleter<T>>;
+
+        /**
+         * @brief Allocates `count` value-initialized elements on a `matrix_alignment` boundary.
+         */
+        template <typename T>
+        [[nodiscard]] AlignedBlock<T> makeAlignedBlock(std::size_t count) {
+            if (count == 0) {
+                return AlignedBlock<T> {nullptr, AlignedBlockDeleter<T> {0}};
+            }
+
+            auto* raw = static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t {matrix_alignment}));
+
+            try {
+                std::uninitialized_value_construct_n(raw, count);
+            } catch (...) {
+                ::operator delete(static_cast<void*>(raw), std::align_val_t {matrix_alignment});
+                throw;
+            }
+
+            return AlignedBlock<T> {raw, AlignedBlockDeleter<T> {count}};
+        }
+    }
+
+    /**
+     * @brief Runtime-sized counterpart of `Matrix` for dimensions too large for the stack or unknown at compile time. Elements live in one contiguous row-major heap block aligned to 64 bytes, so moves only hand over the block & are O(1). Operations mirror `Matrix`, but dimension mismatches & bad indices throw `std::logic_error` at runtime instead of failing to compile.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    class DynamicMatrix {
+    private:
+        Impl::AlignedBlock<T> m_data;
+        std::size_t m_rows;
+        std::size_t m_cols;
+
+        [[nodiscard]] std::size_t offsetOf(int row, int col) const noexcept {
+            return static_cast<std::size_t>(row) * m_cols + static_cast<std::size_t>(col);
+        }
+
+        [[nodiscard]] bool hasIndex(int row, int col) const noexcept {
+            return row >= 0 and static_cast<std::size_t>(row) < m_rows and col >= 0 and static_cast<std::size_t>(col) < m_cols;
+        }
+
+        void requireSameShape(const DynamicMatrix& other, const char* message) const {
+            if (m_rows != other.m_rows or m_cols != other.m_cols) {
+                throw std::logic_error {message};
+            }
+        }
+
+    public:
+        DynamicMatrix() noexcept
+        : m_data {nullptr, Impl::AlignedBlockDeleter<T> {0}}, m_rows {0}, m_cols {0} {}
+
+        DynamicMatrix(std::size_t rows, std::size_t cols, MatrixDefaultingOpt opt = MatrixDefaultingOpt::zeroed, T filler = T {})
+        : m_data {Impl::makeAlignedBlock<T>(rows * cols)}, m_rows {rows}, m_cols {cols} {
+            if (opt != MatrixDefaultingOpt::identity or rows != cols) {
+                return;
+            }
+
+            for (auto row_col_i = 0UL; row_col_i < rows; row_col_i++) {
+                m_data[row_col_i * cols + row_col_i] = filler;
+            }
+        }
+
+        DynamicMatrix(std::size_t rows, std::size_t cols, const T& filler)
+        : m_data {Impl::makeAlignedBlock<T>(rows * cols)}, m_rows {rows}, m_cols {cols} {
+            std::fill_n(m_data.get(), area(), filler);
+        }
+
+        template <std::size_t Rows, std::size_t Cols>
+        explicit DynamicMatrix(const Matrix<T, Rows, Cols>& fixed)
+        : m_data {Impl::makeAlignedBlock<T>(Rows * Cols)}, m_rows {Rows}, m_cols {Cols} {
+            for (auto row_idx = 0; row_idx < static_cast<int>(Rows); row_idx++) {
+                for (auto col_idx = 0; col_idx < static_cast<int>(Cols); col_idx++) {
+                    m_data[offsetOf(row_idx, col_idx)] = fixed[row_idx, col_idx];
+                }
+            }
+        }
+
+        DynamicMatrix(const DynamicMatrix& other)
+        : m_data {Impl::makeAlignedBlock<T>(other.area())}, m_rows {other.m_rows}, m_cols {other.m_cols} {
+            std::copy_n(other.m_data.get(), area(), m_data.get());
+        }
+
+        DynamicMatrix(DynamicMatrix&& other) noexcept
+        : m_data {std::exchange(other.m_data, Impl::AlignedBlock<T> {nullptr, Impl::AlignedBlockDeleter<T> {0}})}, m_rows {std::exchange(other.m_rows, 0)}, m_cols {std::exchange(other.m_cols, 0)} {}
+
+        DynamicMatrix& operator=(const DynamicMatrix& other) {
+            if (&other == this) {
+                return *this;
+            }
+
+            /// NOTE: reuse the block when the element counts already agree.
+            if (area() != other.area()) {
+                m_data = Impl::makeAlignedBlock<T>(other.area());
+            }
+
+            m_rows = other.m_rows;
+            m_cols = other.m_cols;
+            std::copy_n(other.m_data.get(), area(), m_data.get());
+
+            return *this;
+        }
+
+        DynamicMatrix& operator=(DynamicMatrix&& other) noexcept {
+            if (&other == this) {
+                return *this;
+            }
+
+            m_data = std::exchange(other.m_data, Impl::AlignedBlock<T> {nullptr, Impl::AlignedBlockDeleter<T> {0}});
+            m_rows = std::exchange(other.m_rows, 0);
+            m_cols = std::exchange(other.m_cols, 0);
+
+            return *this;
+        }
+
+        [[nodiscard]] std::size_t rows() const noexcept {
+            return m_rows;
+        }
+
+        [[nodiscard]] std::size_t cols() const noexcept {
+            return m_cols;
+        }
+
+        [[nodiscard]] std::size_t area() const noexcept {
+            return m_rows * m_cols;
+        }
+
+        [[nodiscard]] bool isSquare() const noexcept {
+            return m_rows == m_cols;
+        }
+
+        /// NOTE: the whole row-major block as one flat span.
+        [[nodiscard]] std::span<T> elements() & noexcept {
+            return {m_data.get(), area()};
+        }
+
+        [[nodiscard]] std::span<const T> elements() const& noexcept {
+            return {m_data.get(), area()};
+        }
+
+        T& operator[](int row, int col) noexcept {
+            return m_data[offsetOf(row, col)];
+        }
+
+        const T& operator[](int row, int col) const noexcept {
+            return m_data[offsetOf(row, col)];
+        }
+
+        T& at(int row, int col) {
+            if (not hasIndex(row, col)) {
+                throw std::logic_error {"Invalid row-col index of DynamicMatrix."};
+            }
+
+            return m_data[offsetOf(row, col)];
+        }
+
+        const T& at(int row, int col) const {
+            if (not hasIndex(row, col)) {
+                throw std::logic_error {"Invalid row-col index of DynamicMatrix."};
+            }
+
+            return m_data[offsetOf(row, col)];
+        }
+
+        /**
+         * @brief Copies out the `rows_c` by `cols_c` sub-matrix whose top-left element is at `start_row`, `start_col`.
+         *
+         * @param start_row
+         * @param start_col
+         * @param rows_c
+         * @param cols_c
+         * @return DynamicMatrix
+         */
+        [[nodiscard]] DynamicMatrix chop(std::size_t start_row, std::size_t start_col, std::size_t rows_c, std::size_t cols_c) const {
+            if (start_row > m_rows or start_col > m_cols or rows_c > m_rows - start_row or cols_c > m_cols - start_col) {
+                throw std::logic_error {"Invalid bounds passed for DynamicMatrix::chop."};
+            }
+
+            DynamicMatrix temp (rows_c, cols_c);
+
+            for (auto row_i = 0UL; row_i < rows_c; row_i++) {
+                std::copy_n(m_data.get() + (start_row + row_i) * m_cols + start_col, cols_c, temp.m_data.get() + row_i * cols_c);
+            }
+
+            return temp;
+        }
+
+        /**
+         * @brief Copies into a fixed-size `Matrix` when the runtime dimensions match `Rows` & `Cols`.
+         *
+         * @tparam Rows
+         * @tparam Cols
+         * @return std::optional<Matrix<T, Rows, Cols>> empty on a dimension mismatch
+         */
+        template <std::size_t Rows, std::size_t Cols>
+        [[nodiscard]] std::optional<Matrix<T, Rows, Cols>> toFixed() const {
+            if (m_rows != Rows or m_cols != Cols) {
+                return {};
+            }
+
+            Matrix<T, Rows, Cols> fixed {};
+
+            for (auto row_idx = 0; row_idx < static_cast<int>(Rows); row_idx++) {
+                for (auto col_idx = 0; col_idx < static_cast<int>(Cols); col_idx++) {
+                    fixed[row_idx, col_idx] = m_data[offsetOf(row_idx, col_idx)];
+                }
+            }
+
+            return fixed;
+        }
+
+        DynamicMatrix& operator+=(const DynamicMatrix& rhs) {
+            requireSameShape(rhs, "Invalid dimensions passed for DynamicMatrix::operator+=.");
+
+            if constexpr (SimdElementKind<T>) {
+                if (area() >= Impl::simd_min_elements) {
+                    Impl::addElements(elements(), rhs.elements());
+
+                    return *this;
+                }
+            }
+
+            for (auto elem_idx = 0UL; elem_idx < area(); elem_idx++) {
+                m_data[elem_idx] += rhs.m_data[elem_idx];
+            }
+
+            return *this;
+        }
+
+        DynamicMatrix& operator-=(const DynamicMatrix& rhs) {
+            requireSameShape(rhs, "Invalid dimensions passed for DynamicMatrix::operator-=.");
+
+            if constexpr (SimdElementKind<T>) {
+                if (area() >= Impl::simd_min_elements) {
+                    Impl::subtractElements(elements(), rhs.elements());
+
+                    return *this;
+                }
+            }
+
+            for (auto elem_idx = 0UL; elem_idx < area(); elem_idx++) {
+                m_data[elem_idx] -= rhs.m_data[elem_idx];
+            }
+
+            return *this;
+        }
+
+        DynamicMatrix& operator*=(const T& scalar) noexcept (std::is_nothrow_assignable_v<T&, T>) {
+            if constexpr (SimdElementKind<T>) {
+                if (area() >= Impl::simd_min_elements) {
+                    Impl::scaleElements(elements(), scalar);
+
+                    return *this;
+                }
+            }
+
+            for (auto elem_idx = 0UL; elem_idx < area(); elem_idx++) {
+                m_data[elem_idx] *= scalar;
+            }
+
+            return *this;
+        }
+
+        [[nodiscard]] DynamicMatrix operator*(const DynamicMatrix& other) const {
+            if (m_cols != other.m_rows) {
+                throw std::logic_error {"Invalid dimensions passed for DynamicMatrix::operator*(DynamicMatrix)."};
+            }
+
+            DynamicMatrix ans (m_rows, other.m_cols);
+
+            if (m_rows * m_cols * other.m_cols >= Impl::small_product_volume) {
+                const T* lhs = m_data.get();
+                const T* rhs = other.m_data.get();
+                T* out = ans.m_data.get();
+                const auto lhs_cols = m_cols;
+                const auto rhs_cols = other.m_cols;
+
+                multiplyBlocked<T>(m_rows, m_cols, other.m_cols, [lhs, lhs_cols](std::size_t row, std::size_t depth_i) noexcept {
+                    return lhs[row * lhs_cols + depth_i];
+                }, [rhs, rhs_cols](std::size_t depth_i, std::size_t col) noexcept {
+                    return rhs[depth_i * rhs_cols + col];
+                }, [out, rhs_cols](std::size_t row, std::size_t col) noexcept -> T& {
+                    return out[row * rhs_cols + col];
+                });
+
+                return ans;
+            }
+
+            /// NOTE: i-k-j order keeps both `other` & `ans` walked along their rows.
+            for (auto self_row_i = 0UL; self_row_i < m_rows; self_row_i++) {
+                T* ans_row = ans.m_data.get() + self_row_i * other.m_cols;
+
+                for (auto other_row_i = 0UL; other_row_i < other.m_rows; other_row_i++) {
+                    const T& factor = m_data[self_row_i * m_cols + other_row_i];
+                    const T* other_row = other.m_data.get() + other_row_i * other.m_cols;
+
+                    for (auto other_col_i = 0UL; other_col_i < other.m_cols; other_col_i++) {
+                        ans_row[other_col_i] += factor * other_row[other_col_i];
+                    }
+                }
+            }
+
+            return ans;
+        }
+
+        template <std::size_t Rows, std::size_t Cols>
+        [[nodiscard]] DynamicMatrix operator*(const Matrix<T, Rows, Cols>& other) const {
+            return *this * DynamicMatrix {other};
+        }
+
+        bool operator==(const DynamicMatrix& other) const noexcept {
+            if (&other == this) {
+                return true;
+            }
+
+            if (m_rows != other.m_rows or m_cols != other.m_cols) {
+                return false;
+            }
+
+            if constexpr (SimdElementKind<T>) {
+                if (area() >= Impl::simd_min_elements) {
+                    return Impl::equalElements(elements(), other.elements());
+                }
+            }
+
+            return std::equal(m_data.get(), m_data.get() + area(), other.m_data.get());
+        }
+
+        template <std::size_t Rows, std::size_t Cols>
+        bool operator==(const Matrix<T, Rows, Cols>& other) const noexcept {
+            if (m_rows != Rows or m_cols != Cols) {
+                return false;
+            }
+
+            for (auto cmp_row_idx = 0; cmp_row_idx < static_cast<int>(Rows); cmp_row_idx++) {
+                for (auto cmp_col_idx = 0; cmp_col_idx < static_cast<int>(Cols); cmp_col_idx++) {
+                    if (m_data[offsetOf(cmp_row_idx, cmp_col_idx)] != other[cmp_row_idx, cmp_col_idx]) {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+    };
+}
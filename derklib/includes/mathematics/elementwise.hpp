@@ -0,0 +1,315 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace DerkLib::Mathematics::Matrices {
+    /**
+     * @brief Element types with explicitly vectorized element-wise kernels.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    concept SimdElementKind = std::same_as<T, float> or std::same_as<T, double> or std::same_as<T, std::int32_t> or std::same_as<T, std::int64_t>;
+
+    namespace Impl {
+        /// NOTE: below this many elements, the indirect call to a dispatched kernel costs more than the plain loop it replaces.
+        inline constexpr std::size_t simd_min_elements = 16;
+
+        /// NOTE: GCC only applies `vector_size` to a dependent type through a declarator, hence the typedef.
+        template <typename T, std::size_t Width>
+        struct SimdVector {
+            typedef T type __attribute__((vector_size(Width)));
+        };
+
+        /**
+         * @brief Kernel bodies over `Width`-byte GCC vectors. They are always inlined into the per-ISA wrappers below, whose `target` attribute decides whether a vector lowers to SSE2, AVX2 or AVX-512 registers. Loads & stores go through `__builtin_memcpy`, so spans need no particular alignment. Scalar loops finish the tails.
+         */
+        template <typename T, std::size_t Width>
+        [[gnu::always_inline]] inline void addBlocks(T* lhs, const T* rhs, std::size_t count) noexcept {
+            using Vec = typename SimdVector<T, Width>::type;
+            constexpr auto lanes = Width / sizeof(T);
+            std::size_t elem_idx = 0;
+
+            for (; elem_idx + lanes <= count; elem_idx += lanes) {
+                Vec lhs_vec;
+                Vec rhs_vec;
+
+                __builtin_memcpy(&lhs_vec, lhs + elem_idx, sizeof(Vec));
+                __builtin_memcpy(&rhs_vec, rhs + elem_idx, sizeof(Vec));
+                lhs_vec += rhs_vec;
+                __builtin_memcpy(lhs + elem_idx, &lhs_vec, sizeof(Vec));
+            }
+
+            for (; elem_idx < count; elem_idx++) {
+                lhs[elem_idx] += rhs[elem_idx];
+            }
+        }
+
+        template <typename T, std::size_t Width>
+        [[gnu::always_inline]] inline void subtractBlocks(T* lhs, const T* rhs, std::size_t count) noexcept {
+            using Vec = typename SimdVector<T, Width>::type;
+            constexpr auto lanes = Width / sizeof(T);
+            std::size_t elem_idx = 0;
+
+            for (; elem_idx + lanes <= count; elem_idx += lanes) {
+                Vec lhs_vec;
+                Vec rhs_vec;
+
+                __builtin_memcpy(&lhs_vec, lhs + elem_idx, sizeof(Vec));
+                __builtin_memcpy(&rhs_vec, rhs + elem_idx, sizeof(Vec));
+                lhs_vec -= rhs_vec;
+                __builtin_memcpy(lhs + elem_idx, &lhs_vec, sizeof(Vec));
+            }
+
+            for (; elem_idx < count; elem_idx++) {
+                lhs[elem_idx] -= rhs[elem_idx];
+            }
+        }
+
+        template <typename T, std::size_t Width>
+        [[gnu::always_inline]] inline void scaleBlocks(T* lhs, T scalar, std::size_t count) noexcept {
+            using Vec = typename SimdVector<T, Width>::type;
+            constexpr auto lanes = Width / sizeof(T);
+            std::size_t elem_idx = 0;
+
+            for (; elem_idx + lanes <= count; elem_idx += lanes) {
+                Vec lhs_vec;
+
+                __builtin_memcpy(&lhs_vec, lhs + elem_idx, sizeof(Vec));
+                lhs_vec *= scalar;
+                __builtin_memcpy(lhs + elem_idx, &lhs_vec, sizeof(Vec));
+            }
+
+            for (; elem_idx < count; elem_idx++) {
+                lhs[elem_idx] *= scalar;
+            }
+        }
+
+        /// NOTE: compares floating-point lanes with `!=`, so NaNs never match & signed zeros do, exactly like the scalar loop. Four vectors' masks are OR-ed, then folded as 64-bit words, before each early-out test.
+        template <typename T, std::size_t Width>
+        [[gnu::always_inline]] inline bool equalBlocks(const T* lhs, const T* rhs, std::size_t count) noexcept {
+            using Vec = typename SimdVector<T, Width>::type;
+            constexpr auto lanes = Width / sizeof(T);
+            std::size_t elem_idx = 0;
+
+            for (; elem_idx + 4 * lanes <= count; elem_idx += 4 * lanes) {
+                decltype(Vec {} != Vec {}) mismatches {};
+
+                for (auto vec_idx = 0UL; vec_idx < 4; vec_idx++) {
+                    Vec lhs_vec;
+                    Vec rhs_vec;
+
+                    __builtin_memcpy(&lhs_vec, lhs + elem_idx + vec_idx * lanes, sizeof(Vec));
+                    __builtin_memcpy(&rhs_vec, rhs + elem_idx + vec_idx * lanes, sizeof(Vec));
+                    /// NOTE: integer lanes differ exactly when their bits do, & XOR avoids compares the ISA may lack, e.g. 64-bit lanes before SSE4.1.
+                    if constexpr (std::integral<T>) {
+                        mismatches |= lhs_vec ^ rhs_vec;
+                    } else {
+                        mismatches |= (lhs_vec != rhs_vec);
+                    }
+                }
+
+                std::uint64_t mask_words[Width / sizeof(std::uint64_t)];
+                std::uint64_t any_mismatch = 0;
+
+                __builtin_memcpy(mask_words, &mismatches, Width);
+
+                for (const auto mask_word : mask_words) {
+                    any_mismatch |= mask_word;
+                }
+
+                if (any_mismatch != 0) {
+                    return false;
+                }
+            }
+
+            for (; elem_idx < count; elem_idx++) {
+                if (lhs[elem_idx] != rhs[elem_idx]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief One ISA's set of element-wise kernels for `T`, picked once per process by `elementwiseKernels`.
+         *
+         * @tparam T
+         */
+        template <typename T>
+        struct ElementwiseKernels {
+            void (*add)(T*, const T*, std::size_t) noexcept;
+            void (*subtract)(T*, const T*, std::size_t) noexcept;
+            void (*scale)(T*, T, std::size_t) noexcept;
+            bool (*equal)(const T*, const T*, std::size_t) noexcept;
+        };
+
+        template <typename T>
+        void addScalar(T* lhs, const T* rhs, std::size_t count) noexcept {
+            for (auto elem_idx = 0UL; elem_idx < count; elem_idx++) {
+                lhs[elem_idx] += rhs[elem_idx];
+            }
+        }
+
+        template <typename T>
+        void subtractScalar(T* lhs, const T* rhs, std::size_t count) noexcept {
+            for (auto elem_idx = 0UL; elem_idx < count; elem_idx++) {
+                lhs[elem_idx] -= rhs[elem_idx];
+            }
+        }
+
+        template <typename T>
+        void scaleScalar(T* lhs, T scalar, std::size_t count) noexcept {
+            for (auto elem_idx = 0UL; elem_idx < count; elem_idx++) {
+                lhs[elem_idx] *= scalar;
+            }
+        }
+
+        template <typename T>
+        [[nodiscard]] bool equalScalar(const T* lhs, const T* rhs, std::size_t count) noexcept {
+            for (auto elem_idx = 0UL; elem_idx < count; elem_idx++) {
+                if (lhs[elem_idx] != rhs[elem_idx]) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+#if defined(__x86_64__) or defined(__i386__)
+        template <typename T>
+        __attribute__((target("sse2"))) void addSse2(T* lhs, const T* rhs, std::size_t count) noexcept {
+            addBlocks<T, 16>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("sse2"))) void subtractSse2(T* lhs, const T* rhs, std::size_t count) noexcept {
+            subtractBlocks<T, 16>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("sse2"))) void scaleSse2(T* lhs, T scalar, std::size_t count) noexcept {
+            scaleBlocks<T, 16>(lhs, scalar, count);
+        }
+
+        template <typename T>
+        [[nodiscard]] __attribute__((target("sse2"))) bool equalSse2(const T* lhs, const T* rhs, std::size_t count) noexcept {
+            return equalBlocks<T, 16>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("avx2"))) void addAvx2(T* lhs, const T* rhs, std::size_t count) noexcept {
+            addBlocks<T, 32>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("avx2"))) void subtractAvx2(T* lhs, const T* rhs, std::size_t count) noexcept {
+            subtractBlocks<T, 32>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("avx2"))) void scaleAvx2(T* lhs, T scalar, std::size_t count) noexcept {
+            scaleBlocks<T, 32>(lhs, scalar, count);
+        }
+
+        template <typename T>
+        [[nodiscard]] __attribute__((target("avx2"))) bool equalAvx2(const T* lhs, const T* rhs, std::size_t count) noexcept {
+            return equalBlocks<T, 32>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("avx512f"))) void addAvx512(T* lhs, const T* rhs, std::size_t count) noexcept {
+            addBlocks<T, 64>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("avx512f"))) void subtractAvx512(T* lhs, const T* rhs, std::size_t count) noexcept {
+            subtractBlocks<T, 64>(lhs, rhs, count);
+        }
+
+        template <typename T>
+        __attribute__((target("avx512f"))) void scaleAvx512(T* lhs, T scalar, std::size_t count) noexcept {
+            scaleBlocks<T, 64>(lhs, scalar, count);
+        }
+
+        /// NOTE: written with mask-register intrinsics, since without AVX512DQ GCC lowers 64-byte vector compares lane by lane.
+        template <typename T>
+        [[nodiscard]] __attribute__((target("avx512f"))) bool equalAvx512(const T* lhs, const T* rhs, std::size_t count) noexcept {
+            constexpr auto lanes = 64 / sizeof(T);
+            std::size_t elem_idx = 0;
+
+            for (; elem_idx + 4 * lanes <= count; elem_idx += 4 * lanes) {
+                unsigned int mismatches = 0;
+
+                for (auto vec_idx = 0UL; vec_idx < 4; vec_idx++) {
+                    const auto* lhs_at = lhs + elem_idx + vec_idx * lanes;
+                    const auto* rhs_at = rhs + elem_idx + vec_idx * lanes;
+
+                    if constexpr (std::same_as<T, float>) {
+                        mismatches |= _mm512_cmp_ps_mask(_mm512_loadu_ps(lhs_at), _mm512_loadu_ps(rhs_at), _CMP_NEQ_UQ);
+                    } else if constexpr (std::same_as<T, double>) {
+                        mismatches |= _mm512_cmp_pd_mask(_mm512_loadu_pd(lhs_at), _mm512_loadu_pd(rhs_at), _CMP_NEQ_UQ);
+                    } else if constexpr (sizeof(T) == 4) {
+                        mismatches |= _mm512_cmpneq_epi32_mask(_mm512_loadu_si512(lhs_at), _mm512_loadu_si512(rhs_at));
+                    } else {
+                        mismatches |= _mm512_cmpneq_epi64_mask(_mm512_loadu_si512(lhs_at), _mm512_loadu_si512(rhs_at));
+                    }
+                }
+
+                if (mismatches != 0) {
+                    return false;
+                }
+            }
+
+            return equalAvx2(lhs + elem_idx, rhs + elem_idx, count - elem_idx);
+        }
+#endif
+
+        /**
+         * @brief Picks the widest kernel set the running CPU supports (AVX-512F, AVX2, then SSE2, or scalar off x86), once per process & element type.
+         */
+        template <SimdElementKind T>
+        [[nodiscard]] const ElementwiseKernels<T>& elementwiseKernels() noexcept {
+#if defined(__x86_64__) or defined(__i386__)
+            static const ElementwiseKernels<T> kernels = __builtin_cpu_supports("avx512f") ? ElementwiseKernels<T> {&addAvx512<T>, &subtractAvx512<T>, &scaleAvx512<T>, &equalAvx512<T>}
+                : __builtin_cpu_supports("avx2") ? ElementwiseKernels<T> {&addAvx2<T>, &subtractAvx2<T>, &scaleAvx2<T>, &equalAvx2<T>}
+                : ElementwiseKernels<T> {&addSse2<T>, &subtractSse2<T>, &scaleSse2<T>, &equalSse2<T>};
+#else
+            static const ElementwiseKernels<T> kernels {&addScalar<T>, &subtractScalar<T>, &scaleScalar<T>, &equalScalar<T>};
+#endif
+
+            return kernels;
+        }
+
+        /**
+         * @brief Adds `rhs` into `lhs` element by element. Both spans must have the same size.
+         */
+        template <SimdElementKind T>
+        void addElements(std::span<T> lhs, std::span<const T> rhs) noexcept {
+            elementwiseKernels<T>().add(lhs.data(), rhs.data(), lhs.size());
+        }
+
+        template <SimdElementKind T>
+        void subtractElements(std::span<T> lhs, std::span<const T> rhs) noexcept {
+            elementwiseKernels<T>().subtract(lhs.data(), rhs.data(), lhs.size());
+        }
+
+        template <SimdElementKind T>
+        void scaleElements(std::span<T> lhs, T scalar) noexcept {
+            elementwiseKernels<T>().scale(lhs.data(), scalar, lhs.size());
+        }
+
+        template <SimdElementKind T>
+        [[nodiscard]] bool equalElements(std::span<const T> lhs, std::span<const T> rhs) noexcept {
+            return lhs.size() == rhs.size() and elementwiseKernels<T>().equal(lhs.data(), rhs.data(), lhs.size());
+        }
+    }
+}
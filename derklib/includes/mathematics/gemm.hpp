@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace DerkLib::Mathematics::Matrices {
+    /**
+     * @brief Cache block sizes for `multiplyBlocked`. A `depth_block` by `col_block` panel of the right operand is packed once & reused from the last-level cache, a `row_block` by `depth_block` panel of the left operand sits in L2, and one micro-panel of each streams through L1 per register tile. Sizes are rounded up to whole register tiles.
+     */
+    struct GemmBlocking {
+        std::size_t row_block = 96;
+        std::size_t depth_block = 256;
+        std::size_t col_block = 2048;
+    };
+
+    namespace Impl {
+        /// NOTE: one register tile is `tile_rows` rows by 64 bytes' worth of columns, sized for the AVX2 + FMA kernel, where it fills 8 of the 16 `ymm` registers for `double` & `float` alike. The baseline kernel is left to autovectorization at the build's ISA, e.g. 16 `xmm` accumulators on plain x86-64.
+        inline constexpr std::size_t tile_rows = 4;
+
+        template <typename T>
+        inline constexpr std::size_t tile_cols = std::max<std::size_t>(64 / sizeof(T), 4);
+
+        /// NOTE: below this many multiply-adds, packing costs more than it saves.
+        inline constexpr std::size_t small_product_volume = 32 * 32 * 32;
+
+        [[nodiscard]] constexpr std::size_t roundUpTo(std::size_t value, std::size_t step) noexcept {
+            return (std::max<std::size_t>(value, 1) + step - 1) / step * step;
+        }
+
+        /**
+         * @brief Packs `lhs[row_begin .. +rows, depth_begin .. +depth]` into `tile_rows`-high micro-panels, each laid out depth-major so the micro-kernel reads one contiguous column of `tile_rows` values per step. Ragged edges are zero-padded.
+         */
+        template <typename T, typename LhsAt>
+        void packLhs(T* packed, LhsAt& lhs_at, std::size_t row_begin, std::size_t rows, std::size_t depth_begin, std::size_t depth) {
+            for (auto panel_row = 0UL; panel_row < rows; panel_row += tile_rows) {
+                const auto panel_height = std::min(tile_rows, rows - panel_row);
+
+                for (auto depth_i = 0UL; depth_i < depth; depth_i++) {
+                    for (auto tile_row = 0UL; tile_row < tile_rows; tile_row++) {
+                        *packed++ = (tile_row < panel_height) ? static_cast<T>(lhs_at(row_begin + panel_row + tile_row, depth_begin + depth_i)) : T {};
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Packs `rhs[depth_begin .. +depth, col_begin .. +cols]` into `tile_cols`-wide micro-panels, each laid out depth-major so the micro-kernel reads one contiguous row of `tile_cols` values per step. Ragged edges are zero-padded.
+         */
+        template <typename T, typename RhsAt>
+        void packRhs(T* packed, RhsAt& rhs_at, std::size_t depth_begin, std::size_t depth, std::size_t col_begin, std::size_t cols) {
+            for (auto panel_col = 0UL; panel_col < cols; panel_col += tile_cols<T>) {
+                const auto panel_width = std::min(tile_cols<T>, cols - panel_col);
+
+                for (auto depth_i = 0UL; depth_i < depth; depth_i++) {
+                    for (auto tile_col = 0UL; tile_col < tile_cols<T>; tile_col++) {
+                        *packed++ = (tile_col < panel_width) ? static_cast<T>(rhs_at(depth_begin + depth_i, col_begin + panel_col + tile_col)) : T {};
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Multiplies one packed `tile_rows` by `depth` micro-panel with one packed `depth` by `tile_cols` micro-panel, accumulating the rank-1 updates in a register tile that is stored row-major into `tile_out` at the end. It is always inlined into the per-ISA wrappers below, whose `target` attribute decides the vector width.
+         */
+        template <typename T>
+        [[gnu::always_inline]] inline void accumulateTileBody(const T* packed_lhs, const T* packed_rhs, std::size_t depth, T* tile_out) {
+            constexpr auto cols_n = tile_cols<T>;
+            T tile[tile_rows][cols_n] {};
+
+            for (auto depth_i = 0UL; depth_i < depth; depth_i++) {
+                const T* lhs_column = packed_lhs + depth_i * tile_rows;
+                const T* rhs_row = packed_rhs + depth_i * cols_n;
+
+                for (auto tile_row = 0UL; tile_row < tile_rows; tile_row++) {
+                    const auto factor = lhs_column[tile_row];
+
+                    for (auto tile_col = 0UL; tile_col < cols_n; tile_col++) {
+                        tile[tile_row][tile_col] += factor * rhs_row[tile_col];
+                    }
+                }
+            }
+
+            for (auto tile_row = 0UL; tile_row < tile_rows; tile_row++) {
+                for (auto tile_col = 0UL; tile_col < cols_n; tile_col++) {
+                    tile_out[tile_row * cols_n + tile_col] = tile[tile_row][tile_col];
+                }
+            }
+        }
+
+        template <typename T>
+        void accumulateTileBaseline(const T* packed_lhs, const T* packed_rhs, std::size_t depth, T* tile_out) {
+            accumulateTileBody(packed_lhs, packed_rhs, depth, tile_out);
+        }
+
+#if defined(__x86_64__) or defined(__i386__)
+        template <typename T>
+        __attribute__((target("avx2,fma"))) void accumulateTileAvx2(const T* packed_lhs, const T* packed_rhs, std::size_t depth, T* tile_out) {
+            accumulateTileBody(packed_lhs, packed_rhs, depth, tile_out);
+        }
+#endif
+
+        template <typename T>
+        using TileKernel = void (*)(const T*, const T*, std::size_t, T*);
+
+        /**
+         * @brief Picks the AVX2 + FMA micro-kernel for arithmetic `T` when the running CPU supports it, else the baseline one, once per process & element type.
+         */
+        template <typename T>
+        [[nodiscard]] TileKernel<T> tileKernel() noexcept {
+#if defined(__x86_64__) or defined(__i386__)
+            if constexpr (std::is_arithmetic_v<T>) {
+                static const TileKernel<T> kernel = (__builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma")) ? &accumulateTileAvx2<T> : &accumulateTileBaseline<T>;
+
+                return kernel;
+            }
+#endif
+
+            return &accumulateTileBaseline<T>;
+        }
+
+        /// NOTE: adds the valid `height` by `width` corner of a row-major `tile` into the output.
+        template <typename T, typename OutAt>
+        void storeTile(const T* tile, OutAt& out_at, std::size_t row_begin, std::size_t col_begin, std::size_t height, std::size_t width) {
+            for (auto tile_row = 0UL; tile_row < height; tile_row++) {
+                for (auto tile_col = 0UL; tile_col < width; tile_col++) {
+                    out_at(row_begin + tile_row, col_begin + tile_col) += tile[tile_row * tile_cols<T> + tile_col];
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Adds the `rows` by `depth` left operand times the `depth` by `cols` right operand into the output, in the Goto/BLIS loop order: column panels of the right operand, then depth panels, then row panels of the left operand, then register tiles. Register tiles run on an AVX2 + FMA micro-kernel when the CPU has one. Operands are read through element accessors only while packing, so any storage layout works & the O(n^3) inner work always runs over contiguous packed panels.
+     *
+     * @tparam T element type of the packed panels & the output
+     * @param rows
+     * @param depth
+     * @param cols
+     * @param lhs_at `(row, depth_i) -> value` of the left operand
+     * @param rhs_at `(depth_i, col) -> value` of the right operand
+     * @param out_at `(row, col) -> T&` of the output, which is accumulated into rather than overwritten
+     * @param blocking cache block sizes
+     */
+    template <typename T, typename LhsAt, typename RhsAt, typename OutAt>
+    void multiplyBlocked(std::size_t rows, std::size_t depth, std::size_t cols, LhsAt&& lhs_at, RhsAt&& rhs_at, OutAt&& out_at, const GemmBlocking& blocking = {}) {
+        const auto row_block = Impl::roundUpTo(blocking.row_block, Impl::tile_rows);
+        const auto depth_block = std::max<std::size_t>(blocking.depth_block, 1);
+        const auto col_block = Impl::roundUpTo(blocking.col_block, Impl::tile_cols<T>);
+
+        std::vector<T> packed_lhs (std::min(row_block, Impl::roundUpTo(rows, Impl::tile_rows)) * std::min(depth_block, depth));
+        std::vector<T> packed_rhs (std::min(col_block, Impl::roundUpTo(cols, Impl::tile_cols<T>)) * std::min(depth_block, depth));
+        std::vector<T> tile (Impl::tile_rows * Impl::tile_cols<T>);
+        const auto accumulate_tile = Impl::tileKernel<T>();
+
+        for (auto col_begin = 0UL; col_begin < cols; col_begin += col_block) {
+            const auto col_span = std::min(col_block, cols - col_begin);
+
+            for (auto depth_begin = 0UL; depth_begin < depth; depth_begin += depth_block) {
+                const auto depth_span = std::min(depth_block, depth - depth_begin);
+
+                Impl::packRhs(packed_rhs.data(), rhs_at, depth_begin, depth_span, col_begin, col_span);
+
+                for (auto row_begin = 0UL; row_begin < rows; row_begin += row_block) {
+                    const auto row_span = std::min(row_block, rows - row_begin);
+
+                    Impl::packLhs(packed_lhs.data(), lhs_at, row_begin, row_span, depth_begin, depth_span);
+
+                    for (auto tile_col = 0UL; tile_col < col_span; tile_col += Impl::tile_cols<T>) {
+                        const T* rhs_panel = packed_rhs.data() + tile_col * depth_span;
+
+                        for (auto tile_row = 0UL; tile_row < row_span; tile_row += Impl::tile_rows) {
+                            accumulate_tile(packed_lhs.data() + tile_row * depth_span, rhs_panel, depth_span, tile.data());
+                            Impl::storeTile(tile.data(), out_at, row_begin + tile_row, col_begin + tile_col, std::min(Impl::tile_rows, row_span - tile_row), std::min(Impl::tile_cols<T>, col_span - tile_col));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <array>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
+#include "mathematics/elementwise.hpp"
+#include "mathematics/gemm.hpp"
 #include "meta/maths.hpp"
 
 namespace DerkLib::Mathematics::Matrices {
@@ -13,7 +16,7 @@ namespace DerkLib::Mathematics::Matrices {
     };
 
     /**
-     * @brief Represents an NxM matrix where `N` is rows & `M` is cols. The basic arithmetic operations of addition, subtraction, and multiplication are provided. Finally, this class has a `chop` method that slices off a sub-matrix starting at a position if positioning & bounds are valid.
+     * @brief Represents an NxM matrix where `N` is rows & `M` is cols, stored inline as one flat row-major array. The basic arithmetic operations of addition, subtraction, and multiplication are provided, with the element-wise ones running on runtime-dispatched SIMD kernels for `SimdElementKind` types. Finally, this class has a `chop` method that slices off a sub-matrix starting at a position if positioning & bounds are valid.
      * 
      * @tparam T 
      * @tparam Rows 
@@ -22,21 +25,22 @@ namespace DerkLib::Mathematics::Matrices {
     template <typename T, std::size_t Rows, std::size_t Cols>
     class Matrix {
     private:
-        std::array<std::array<T, Cols>, Rows> m_data;
+        std::array<T, Rows * Cols> m_data;
+
+        /// NOTE: element-wise ops take the dispatched SIMD kernels only where they beat the plain loop.
+        static constexpr bool uses_simd_kernels = SimdElementKind<T> and Rows * Cols >= Impl::simd_min_elements;
 
     public:
         explicit Matrix(MatrixDefaultingOpt opt = MatrixDefaultingOpt::zeroed, T filler = T {}) noexcept(std::is_nothrow_assignable_v<T, T>)
         : m_data {} {
-            for (auto& row : m_data) {
-                std::fill(row.begin(), row.end(), T {});
-            }
+            std::fill(m_data.begin(), m_data.end(), T {});
 
             if (opt != MatrixDefaultingOpt::identity or Rows != Cols) {
                 return;
             }
 
             for (auto row_col_i = 0UL; row_col_i < Rows; row_col_i++) {
-                m_data[row_col_i][row_col_i] = filler;
+                m_data[row_col_i * Cols + row_col_i] = filler;
             }
         }
 
@@ -45,7 +49,7 @@ namespace DerkLib::Mathematics::Matrices {
         : m_data {} {
             for (auto fill_row = 0UL; fill_row < Rows; fill_row++) {
                 for (auto fill_col = 0UL; fill_col < Cols; fill_col++) {
-                    m_data[fill_row][fill_col] = arg;
+                    m_data[fill_row * Cols + fill_col] = arg;
                 }
             }
         }
@@ -59,11 +63,11 @@ namespace DerkLib::Mathematics::Matrices {
         }
 
         T& operator[](int row, int col) noexcept {
-            return m_data[row][col];
+            return m_data[row * Cols + col];
         }
 
         const T& operator[](int row, int col) const noexcept {
-            return m_data[row][col];
+            return m_data[row * Cols + col];
         }
 
         T& at(int row, int col) {
@@ -71,7 +75,7 @@ namespace DerkLib::Mathematics::Matrices {
                 throw std::logic_error {"Invalid row-col index of Matrix."};
             }
 
-            return m_data[row][col];
+            return m_data[row * Cols + col];
         }
 
         template <std::size_t StartRow, std::size_t StartCol, std::size_t RowsC, std::size_t ColsC> requires (
@@ -90,7 +94,7 @@ namespace DerkLib::Mathematics::Matrices {
 
             for (int row_i = start_row_n; row_i < end_row_n; row_i++) {
                 for (int col_i = start_col_n; col_i < end_col_n; col_i++) {
-                    temp[row_i, col_i] = m_data[row_i][col_i];
+                    temp[row_i, col_i] = m_data[row_i * Cols + col_i];
                 }
             }
 
@@ -98,12 +102,18 @@ namespace DerkLib::Mathematics::Matrices {
         }
 
         Matrix& operator+=(const Matrix<T, Rows, Cols>& rhs) noexcept (std::is_nothrow_assignable_v<T, T>) {
+            if constexpr (uses_simd_kernels) {
+                Impl::addElements(std::span<T> {m_data}, std::span<const T> {rhs.m_data});
+
+                return *this;
+            }
+
             const auto rows_n = static_cast<int>(Rows);
             const auto cols_n = static_cast<int>(Cols);
 
             for (auto row_idx = 0; row_idx < rows_n; row_idx++) {
                 for (auto col_idx = 0; col_idx < cols_n; col_idx++) {
-                    m_data[row_idx][col_idx] += rhs[row_idx, col_idx];
+                    m_data[row_idx * Cols + col_idx] += rhs[row_idx, col_idx];
                 }
             }
 
@@ -111,12 +121,18 @@ namespace DerkLib::Mathematics::Matrices {
         }
 
         Matrix& operator-=(const Matrix<T, Rows, Cols>& rhs) noexcept (std::is_nothrow_assignable_v<T, T>) {
+            if constexpr (uses_simd_kernels) {
+                Impl::subtractElements(std::span<T> {m_data}, std::span<const T> {rhs.m_data});
+
+                return *this;
+            }
+
             const auto rows_n = static_cast<int>(Rows);
             const auto cols_n = static_cast<int>(Cols);
 
             for (auto row_idx = 0; row_idx < rows_n; row_idx++) {
                 for (auto col_idx = 0; col_idx < cols_n; col_idx++) {
-                    m_data[row_idx][col_idx] -= rhs[row_idx, col_idx];
+                    m_data[row_idx * Cols + col_idx] -= rhs[row_idx, col_idx];
                 }
             }
 
@@ -124,12 +140,18 @@ namespace DerkLib::Mathematics::Matrices {
         }
 
         Matrix& operator*=(const T& scalar) noexcept (std::is_nothrow_assignable_v<T, T>) {
+            if constexpr (uses_simd_kernels) {
+                Impl::scaleElements(std::span<T> {m_data}, scalar);
+
+                return *this;
+            }
+
             const auto rows_n = static_cast<int>(Rows);
             const auto cols_n = static_cast<int>(Cols);
 
             for (auto row_idx = 0; row_idx < rows_n; row_idx++) {
                 for (auto col_idx = 0; col_idx < cols_n; col_idx++) {
-                    m_data[row_idx][col_idx] *= scalar;
+                    m_data[row_idx * Cols + col_idx] *= scalar;
                 }
             }
 
@@ -137,7 +159,7 @@ namespace DerkLib::Mathematics::Matrices {
         }
 
         template <template <typename, std::size_t, std::size_t> typename OtherMat, typename OtherItem, std::size_t OtherRows, std::size_t OtherCols> requires (Meta::Maths::MatrixKind<OtherMat, OtherItem, OtherRows, OtherCols>)
-        [[nodiscard]] auto operator*(const OtherMat<OtherItem, OtherRows, OtherCols>& other) noexcept (std::is_nothrow_assignable_v<T, OtherItem>) -> Meta::Maths::ProductOfMatrices<Matrix, T, Rows, Cols, OtherMat, OtherItem, OtherRows, OtherCols> {
+        [[nodiscard]] auto operator*(const OtherMat<OtherItem, OtherRows, OtherCols>& other) noexcept (std::is_nothrow_assignable_v<T&, OtherItem> and Rows * OtherRows * OtherCols < Impl::small_product_volume) -> Meta::Maths::ProductOfMatrices<Matrix, T, Rows, Cols, OtherMat, OtherItem, OtherRows, OtherCols> {
             if constexpr (not Meta::Maths::AreMatDimsCompatible<Rows, Cols, OtherRows, OtherCols>) {
                 throw std::logic_error {"Invalid dimensions passed for Matrix<T, Rows, Cols>::operator*(Matrix<T2, Rows2, Cols2>)."};
             }
@@ -150,10 +172,23 @@ namespace DerkLib::Mathematics::Matrices {
 
             AnsMatrix ans;
 
+            /// NOTE: small products stay on the plain triple loop, where packing panels would cost more than it saves. Larger ones allocate packing buffers, which is why the operator is only `noexcept` below that volume.
+            if constexpr (Rows * OtherRows * OtherCols >= Impl::small_product_volume) {
+                multiplyBlocked<T>(Rows, OtherRows, OtherCols, [this](std::size_t row, std::size_t depth_i) noexcept {
+                    return m_data[row * Cols + depth_i];
+                }, [&other](std::size_t depth_i, std::size_t col) {
+                    return other[static_cast<int>(depth_i), static_cast<int>(col)];
+                }, [&ans](std::size_t row, std::size_t col) noexcept -> T& {
+                    return ans[static_cast<int>(row), static_cast<int>(col)];
+                });
+
+                return ans;
+            }
+
             for (auto self_row_i = 0; self_row_i < self_row_n; self_row_i++) {
                 for (auto other_col_i = 0; other_col_i < other_col_n; other_col_i++) {
                     for (auto other_row_i = 0; other_row_i < other_row_n; other_row_i++) {
-                        ans[self_row_i, other_col_i] += m_data[self_row_i][other_row_i] * other[other_row_i, other_col_i];
+                        ans[self_row_i, other_col_i] += m_data[self_row_i * Cols + other_row_i] * other[other_row_i, other_col_i];
                     }
                 }
             }
@@ -166,12 +201,18 @@ namespace DerkLib::Mathematics::Matrices {
                 return true;
             }
 
+            if constexpr (uses_simd_kernels) {
+                if not consteval {
+                    return Impl::equalElements(std::span<const T> {m_data}, std::span<const T> {other.m_data});
+                }
+            }
+
             const auto rows_n = static_cast<int>(Rows);
             const auto cols_n = static_cast<int>(Cols);
 
             for (auto cmp_row_idx = 0; cmp_row_idx < rows_n; cmp_row_idx++) {
                 for (auto cmp_col_idx = 0; cmp_col_idx < cols_n; cmp_col_idx++) {
-                    if (m_data[cmp_row_idx][cmp_col_idx] != other[cmp_row_idx, cmp_col_idx]) {
+                    if (m_data[cmp_row_idx * Cols + cmp_col_idx] != other[cmp_row_idx, cmp_col_idx]) {
                         return false;
                     }
                 }
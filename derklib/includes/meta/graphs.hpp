@@ -0,0 +1,61 @@
+#pragma once
+
+#include <concepts>
+#include <ranges>
+#include <type_traits>
+
+namespace DerkLib::Meta::Graphs {
+    /**
+     * @brief Describes any graph container that numbers its nodes `[0, size())` and exposes each node's item & an allocation-free neighbor range by index.
+     * 
+     * @tparam G 
+     */
+    template <typename G>
+    concept IndexedGraphKind = requires (const G& arg, int index) {
+        {arg.size()} -> std::same_as<std::size_t>;
+        {arg.itemAt(index)};
+        {arg.neighbors(index)} -> std::ranges::forward_range;
+    };
+
+    /**
+     * @brief Alias for the item type stored by an `IndexedGraphKind`.
+     * 
+     * @tparam G 
+     */
+    template <typename G>
+    using GraphItemOf = std::remove_cvref_t<decltype(std::declval<const G&>().itemAt(0))>;
+
+    /**
+     * @brief Alias for the edge type yielded by a graph's `neighbors(index)`: a destination index, or a `<cost, destination>` pair for weighted graphs.
+     * 
+     * @tparam G 
+     */
+    template <typename G>
+    using GraphEdgeOf = std::ranges::range_value_t<decltype(std::declval<const G&>().neighbors(0))>;
+
+    template <typename G>
+    concept WeightedGraphKind = IndexedGraphKind<G> and requires (const GraphEdgeOf<G>& edge) {
+        {edge.first};
+        {edge.second} -> std::convertible_to<int>;
+    };
+
+    namespace Impl {
+        template <typename Edge>
+        struct EdgeCost {
+            using type = int;
+        };
+
+        template <typename Edge> requires (requires (const Edge& edge) { edge.first; })
+        struct EdgeCost<Edge> {
+            using type = std::remove_cvref_t<decltype(std::declval<const Edge&>().first)>;
+        };
+    }
+
+    /**
+     * @brief Alias for the cost type of a graph's edges: the `first` member of weighted edges, or `int` for unweighted graphs whose edges all cost one hop.
+     * 
+     * @tparam G 
+     */
+    template <typename G>
+    using GraphCostOf = typename Impl::EdgeCost<GraphEdgeOf<G>>::type;
+}
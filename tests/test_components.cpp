@@ -0,0 +1,80 @@
+#include <iostream>
+#include <print>
+#include <vector>
+#include "containers/graph.hpp"
+#include "algorithms/components.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    Algorithms::Graph::UnionFind sets (6);
+
+    sets.unite(0, 1);
+    sets.unite(2, 3);
+    sets.unite(1, 3);
+
+    if (sets.setCount() != 3 or not sets.connected(0, 2) or sets.connected(0, 4) or sets.unite(2, 0)) {
+        std::print(std::cerr, "Unexpected union-find state after merging {{0, 1, 2, 3}}.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents three islands: {0, 3, 6}, {1, 4} & {2, 5}, plus an isolated node 7.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> islands;
+
+    for (auto node = 0; node < 8; node++) {
+        islands.add(node);
+    }
+
+    islands.connectAt(6, 3, EdgeDirection::two_way);
+    islands.connectAt(0, 3, EdgeDirection::two_way);
+    islands.connectAt(4, 1, EdgeDirection::two_way);
+    islands.connectAt(2, 5, EdgeDirection::two_way);
+
+    const std::vector<int> expected_labels {0, 1, 2, 0, 1, 2, 0, 3};
+    const auto island_components = Algorithms::Graph::labelComponents(islands);
+
+    if (island_components.count != 4 or island_components.labels != expected_labels) {
+        std::print(std::cerr, "Unexpected component labels over islands.\n");
+        return 1;
+    }
+
+    if (const auto parallel_components = Algorithms::Graph::labelComponentsParallel(islands.freeze(), 3); parallel_components.count != 4 or parallel_components.labels != expected_labels) {
+        std::print(std::cerr, "Unexpected parallel component labels over islands.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a pseudo-random sparse graph with many small components, checked for agreement between the serial & parallel labelings.
+     */
+    constexpr auto forest_size = 20000;
+    std::vector<int> forest_nodes (forest_size);
+    std::vector<Containers::Graph::IndexEdge> forest_edges;
+    unsigned int lcg_state = 31U;
+
+    for (auto node = 0; node < forest_size; node++) {
+        forest_nodes[node] = node;
+    }
+
+    for (auto edge = 0; edge < forest_size * 9 / 10; edge++) {
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        const auto from = static_cast<int>((lcg_state >> 8) % forest_size);
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        const auto to = static_cast<int>((lcg_state >> 8) % forest_size);
+
+        forest_edges.emplace_back(from, to);
+    }
+
+    const auto forest = Containers::Graph::buildCsrGraph(std::span {forest_nodes}, std::span {forest_edges}, {.direction = EdgeDirection::two_way});
+    const auto forest_components = Algorithms::Graph::labelComponents(*forest);
+
+    for (const auto worker_count : {1U, 2U, 4U}) {
+        if (const auto parallel_forest = Algorithms::Graph::labelComponentsParallel(*forest, worker_count); parallel_forest.count != forest_components.count or parallel_forest.labels != forest_components.labels) {
+            std::print(std::cerr, "Unexpected mismatch between serial & parallel ({} workers) labels over forest.\n", worker_count);
+            return 1;
+        }
+    }
+}
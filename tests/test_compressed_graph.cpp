@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <print>
+#include <utility>
+#include <vector>
+#include "containers/graph.hpp"
+#include "containers/compressed_graph.hpp"
+#include "algorithms/traversals.hpp"
+#include "algorithms/shortest_paths.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+    using NarrowRoadMap = Containers::Graph::Graph<EdgeWeightPolicy::weighted, int, Containers::Graph::LookupPolicy::hashed, std::allocator, std::uint8_t>;
+
+    /**
+     * @brief Represents a pseudo-random road map with byte-sized costs, including parallel edges & far-apart node pairs.
+     */
+    constexpr auto town_count = 2000;
+    NarrowRoadMap roads;
+    unsigned int lcg_state = 11U;
+
+    for (auto town = 0; town < town_count; town++) {
+        roads.add(town);
+    }
+
+    for (auto road = 0; road < 12000; road++) {
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        const auto from = static_cast<int>((lcg_state >> 8) % town_count);
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        const auto to = (road % 3 == 0) ? (from + 1) % town_count : static_cast<int>((lcg_state >> 8) % town_count);
+
+        roads.connectAt(from, to, static_cast<std::uint8_t>(1 + (lcg_state >> 4) % 200), EdgeDirection::two_way);
+    }
+
+    if (roads.connectAt(0, 1, 255, EdgeDirection::one_way); roads.neighbors(0).front() != Containers::Graph::WeightedEdgeOf<std::uint8_t> {255, 1}) {
+        std::print(std::cerr, "Unexpected narrow-cost edge at town 0.\n");
+        return 1;
+    }
+
+    const auto frozen_roads = roads.freeze();
+    const auto packed_roads = Containers::Graph::compressOf(roads);
+
+    if (packed_roads.size() != roads.size() or packed_roads.edgeCount() != frozen_roads.edgeCount()) {
+        std::print(std::cerr, "Unexpected compressed graph shape.\n");
+        return 1;
+    }
+
+    if (packed_roads.encodedBytes() >= frozen_roads.edgeCount() * (sizeof(int) + sizeof(std::uint8_t))) {
+        std::print(std::cerr, "Unexpected encoding of {} bytes for {} edges.\n", packed_roads.encodedBytes(), packed_roads.edgeCount());
+        return 1;
+    }
+
+    for (auto town = 0; town < town_count; town++) {
+        std::vector<std::pair<std::uint8_t, int>> expected (frozen_roads.neighbors(town).begin(), frozen_roads.neighbors(town).end());
+        std::vector<std::pair<std::uint8_t, int>> decoded;
+
+        for (const auto& edge : packed_roads.neighbors(town)) {
+            decoded.emplace_back(edge);
+        }
+
+        std::ranges::sort(expected, {}, [](const auto& edge) noexcept { return std::pair {edge.second, edge.first}; });
+
+        if (decoded != expected) {
+            std::print(std::cerr, "Unexpected decoded neighbors of town {}.\n", town);
+            return 1;
+        }
+    }
+
+    const auto narrow_paths = Algorithms::Graph::searchDijkstra(roads, 0);
+    const auto packed_paths = Algorithms::Graph::searchDijkstra(packed_roads, 0);
+
+    if (narrow_paths.distances != packed_paths.distances) {
+        std::print(std::cerr, "Unexpected Dijkstra mismatch over the compressed road map.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents an unweighted ring, whose neighbors straddle each node index from both sides.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> ring;
+
+    for (auto node = 0; node < 300; node++) {
+        ring.add(node);
+    }
+
+    for (auto node = 0; node < 300; node++) {
+        ring.connectAt(node, (node + 1) % 300, EdgeDirection::two_way);
+    }
+
+    const auto packed_ring = Containers::Graph::compressOf(ring);
+
+    if (const auto last_edges = packed_ring.neighbors(299); std::ranges::distance(last_edges) != 2 or *last_edges.begin() != 0 or *std::next(last_edges.begin()) != 298) {
+        std::print(std::cerr, "Unexpected decoded neighbors of the last ring node.\n");
+        return 1;
+    }
+
+    if (Algorithms::Graph::searchBFS(packed_ring, 0).levels != Algorithms::Graph::searchBFS(ring, 0).levels) {
+        std::print(std::cerr, "Unexpected BFS levels over the compressed ring.\n");
+        return 1;
+    }
+}
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <print>
+#include <thread>
+#include <vector>
+#include "containers/concurrent_graph.hpp"
+#include "algorithms/traversals.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    constexpr auto node_count = 1000;
+    constexpr auto writer_count = 6;
+    constexpr auto edges_per_writer = 40000;
+
+    std::vector<int> node_items (node_count);
+
+    std::iota(node_items.begin(), node_items.end(), 0);
+
+    /**
+     * @brief Represents a stress run where every writer hammers the same few hub nodes along with a spread of others. Each writer's edges are fully determined by its id, so the final adjacency can be checked as a multiset.
+     */
+    auto edgeOf = [](int writer_id, int edge_id) noexcept {
+        const auto from = (edge_id % 4 == 0) ? edge_id % 3 : (edge_id * 31 + writer_id) % node_count;
+
+        return std::pair {from, (edge_id * 17 + writer_id * 101) % node_count};
+    };
+
+    Containers::Graph::ConcurrentGraph<EdgeWeightPolicy::unweighted, int> hubs {node_items, 4096};
+    std::vector<std::thread> writers;
+
+    for (auto writer_id = 0; writer_id < writer_count; writer_id++) {
+        writers.emplace_back([&hubs, &edgeOf, writer_id]() {
+            auto writer = hubs.writer();
+
+            for (auto edge_id = 0; edge_id < edges_per_writer; edge_id++) {
+                const auto [from, to] = edgeOf(writer_id, edge_id);
+
+                writer.connectAt(from, to, (edge_id % 10 == 0) ? EdgeDirection::two_way : EdgeDirection::one_way);
+            }
+        });
+    }
+
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    std::vector<std::vector<int>> expected (node_count);
+
+    for (auto writer_id = 0; writer_id < writer_count; writer_id++) {
+        for (auto edge_id = 0; edge_id < edges_per_writer; edge_id++) {
+            const auto [from, to] = edgeOf(writer_id, edge_id);
+
+            expected[from].emplace_back(to);
+
+            if (edge_id % 10 == 0) {
+                expected[to].emplace_back(from);
+            }
+        }
+    }
+
+    const auto frozen_hubs = hubs.freeze();
+
+    for (auto node = 0; node < node_count; node++) {
+        std::vector<int> ingested (frozen_hubs.targetsOf(node).begin(), frozen_hubs.targetsOf(node).end());
+
+        std::ranges::sort(ingested);
+        std::ranges::sort(expected[node]);
+
+        if (ingested != expected[node]) {
+            std::print(std::cerr, "Unexpected adjacency of node {}: {} edges vs {} expected.\n", node, ingested.size(), expected[node].size());
+            return 1;
+        }
+    }
+
+    if (Algorithms::Graph::searchBFS(hubs, 0).levels != Algorithms::Graph::searchBFS(frozen_hubs, 0).levels) {
+        std::print(std::cerr, "Unexpected BFS mismatch between the live & frozen graphs.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a weighted ring built by two writers, one per direction.
+     */
+    Containers::Graph::ConcurrentGraph<EdgeWeightPolicy::weighted, int> ring {std::vector<int>(node_items.cbegin(), node_items.cbegin() + 100)};
+    std::thread clockwise_writer {[&ring]() {
+        auto writer = ring.writer();
+
+        for (auto node = 0; node < 100; node++) {
+            writer.connectAt(node, (node + 1) % 100, 1, EdgeDirection::one_way);
+        }
+    }};
+    std::thread counter_writer {[&ring]() {
+        auto writer = ring.writer();
+
+        for (auto node = 0; node < 100; node++) {
+            writer.connectAt((node + 1) % 100, node, 2, EdgeDirection::one_way);
+        }
+    }};
+
+    clockwise_writer.join();
+    counter_writer.join();
+
+    if (const auto frozen_ring = ring.freeze(); frozen_ring.edgeCount() != 200 or std::accumulate(frozen_ring.costs().begin(), frozen_ring.costs().end(), 0) != 300) {
+        std::print(std::cerr, "Unexpected weighted ring after concurrent ingestion.\n");
+        return 1;
+    }
+}
@@ -0,0 +1,117 @@
+#include <iostream>
+#include <print>
+#include <span>
+#include <vector>
+#include "containers/graph.hpp"
+#include "algorithms/directed.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    /**
+     * @brief Represents build targets where {lib, util} and {app, plugin, loader} are dependency cycles, and docs stands alone.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, const char*> targets;
+
+    for (const auto target : {"lib", "util", "app", "plugin", "loader", "docs"}) {
+        targets.add(target);
+    }
+
+    targets.connectAt(0, 1, EdgeDirection::one_way);
+    targets.connectAt(1, 0, EdgeDirection::one_way);
+    targets.connectAt(2, 3, EdgeDirection::one_way);
+    targets.connectAt(3, 4, EdgeDirection::one_way);
+    targets.connectAt(4, 2, EdgeDirection::one_way);
+    targets.connectAt(2, 0, EdgeDirection::one_way);
+
+    const auto target_groups = Algorithms::Graph::labelStrongComponents(targets);
+    const auto& group_of = target_groups.labels;
+
+    if (target_groups.count != 3 or group_of[0] != group_of[1] or group_of[2] != group_of[3] or group_of[3] != group_of[4] or group_of[0] == group_of[2] or group_of[5] == group_of[0] or group_of[5] == group_of[2]) {
+        std::print(std::cerr, "Unexpected strong components of build targets.\n");
+        return 1;
+    }
+
+    if (group_of[2] <= group_of[0]) {
+        std::print(std::cerr, "Unexpected component order: app's group must complete after lib's.\n");
+        return 1;
+    }
+
+    if (Algorithms::Graph::sortTopologically(targets)) {
+        std::print(std::cerr, "Unexpected topological order of cyclic build targets.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a pseudo-random DAG (edges only run from lower to higher index) whose topological order must put every edge forward, and whose components are all singletons.
+     */
+    constexpr auto dag_size = 2000;
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, int> dag;
+    unsigned int lcg_state = 77U;
+
+    for (auto node = 0; node < dag_size; node++) {
+        dag.add(node);
+    }
+
+    for (auto edge = 0; edge < dag_size * 5; edge++) {
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        const auto from = static_cast<int>((lcg_state >> 8) % (dag_size - 1));
+        lcg_state = lcg_state * 1103515245U + 12345U;
+
+        dag.connectAt(from, from + 1 + static_cast<int>((lcg_state >> 8) % (dag_size - 1 - from)), 1, EdgeDirection::one_way);
+    }
+
+    const auto dag_order = Algorithms::Graph::sortTopologically(dag);
+
+    if (not dag_order or dag_order->size() != dag_size) {
+        std::print(std::cerr, "Unexpected missing topological order of the DAG.\n");
+        return 1;
+    }
+
+    std::vector<int> positions (dag_size);
+
+    for (auto position = 0; position < dag_size; position++) {
+        positions[(*dag_order)[position]] = position;
+    }
+
+    for (auto node = 0; node < dag_size; node++) {
+        for (const auto& [cost, adj_index] : dag.neighbors(node)) {
+            if (positions[node] >= positions[adj_index]) {
+                std::print(std::cerr, "Unexpected backward edge {} -> {} in topological order.\n", node, adj_index);
+                return 1;
+            }
+        }
+    }
+
+    if (Algorithms::Graph::labelStrongComponents(dag).count != dag_size) {
+        std::print(std::cerr, "Unexpected non-singleton strong component in the DAG.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a one-way ring of a million nodes with a tail: one giant component that a recursive Tarjan would overflow the stack on.
+     */
+    constexpr auto ring_length = 1000000;
+    std::vector<int> ring_nodes (ring_length + 1);
+    std::vector<Containers::Graph::IndexEdge> ring_links;
+
+    for (auto node = 0; node <= ring_length; node++) {
+        ring_nodes[node] = node;
+    }
+
+    for (auto node = 0; node < ring_length; node++) {
+        ring_links.emplace_back(node, (node + 1) % ring_length);
+    }
+
+    ring_links.emplace_back(ring_length - 1, ring_length);
+
+    const auto ring = Containers::Graph::buildCsrGraph(std::span {ring_nodes}, std::span {ring_links});
+    const auto ring_groups = Algorithms::Graph::labelStrongComponents(*ring);
+
+    if (ring_groups.count != 2 or ring_groups.labels[0] != ring_groups.labels[ring_length - 1] or ring_groups.labels[ring_length] != 0) {
+        std::print(std::cerr, "Unexpected strong components of the giant ring.\n");
+        return 1;
+    }
+}
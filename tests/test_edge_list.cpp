@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <print>
+#include <vector>
+#include "containers/graph.hpp"
+#include "containers/edge_list.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    const auto scratch_dir = std::filesystem::temp_directory_path();
+    const auto roads_path = scratch_dir / "derklib_test_roads.edges";
+    const auto broken_path = scratch_dir / "derklib_test_broken.edges";
+    const auto real_costs_path = scratch_dir / "derklib_test_real_costs.edges";
+    const auto large_path = scratch_dir / "derklib_test_large.edges";
+    const auto rejected_path = scratch_dir / "derklib_test_rejected.edges";
+
+    /**
+     * @brief Represents a hand-written list with comments, blank lines, tabs, CRLF endings & no final newline.
+     */
+    {
+        std::ofstream roads_file {roads_path, std::ios::binary};
+
+        roads_file << "# src dst cost\r\n0 1 4\r\n\r\n1\t2\t7\n% generated\n  2 0 1  \n3 1";
+    }
+
+    const auto weighted_roads = Containers::Graph::loadEdgeList<EdgeWeightPolicy::weighted>(roads_path);
+
+    if (not weighted_roads or weighted_roads->size() != 4 or weighted_roads->edgeCount() != 4 or weighted_roads->costsOf(1).front() != 7 or weighted_roads->costsOf(3).front() != 1) {
+        std::print(std::cerr, "Unexpected weighted graph loaded from the hand-written list.\n");
+        return 1;
+    }
+
+    const auto two_way_roads = Containers::Graph::loadEdgeList<EdgeWeightPolicy::unweighted>(roads_path, {.direction = EdgeDirection::two_way, .sort_neighbors = true});
+
+    if (not two_way_roads or two_way_roads->edgeCount() != 8 or two_way_roads->targetsOf(1).size() != 3 or two_way_roads->targetsOf(1).front() != 0) {
+        std::print(std::cerr, "Unexpected two-way graph loaded from the hand-written list.\n");
+        return 1;
+    }
+
+    {
+        std::ofstream broken_file {broken_path, std::ios::binary};
+
+        broken_file << "0 1\n1 two\n";
+    }
+
+    if (Containers::Graph::loadEdgeList<EdgeWeightPolicy::unweighted>(broken_path) or Containers::Graph::loadEdgeList<EdgeWeightPolicy::unweighted>(scratch_dir / "derklib_test_missing.edges")) {
+        std::print(std::cerr, "Unexpected success loading a malformed or missing list.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a list with real-valued costs, which an unweighted load skips without converting, while a fourth column is still malformed.
+     */
+    {
+        std::ofstream real_costs_file {real_costs_path, std::ios::binary};
+
+        real_costs_file << "0 1 1.5\n1 2 2.25\n";
+    }
+
+    const auto unweighted_real_costs = Containers::Graph::loadEdgeList<EdgeWeightPolicy::unweighted, double>(real_costs_path);
+
+    if (not unweighted_real_costs or unweighted_real_costs->size() != 3 or unweighted_real_costs->edgeCount() != 2 or unweighted_real_costs->targetsOf(1).front() != 2) {
+        std::print(std::cerr, "Unexpected failure loading a real-valued cost list unweighted.\n");
+        return 1;
+    }
+
+    {
+        std::ofstream real_costs_file {real_costs_path, std::ios::binary | std::ios::trunc};
+
+        real_costs_file << "0 1 1.5 extra\n";
+    }
+
+    if (Containers::Graph::loadEdgeList<EdgeWeightPolicy::unweighted>(real_costs_path)) {
+        std::print(std::cerr, "Unexpected success loading an unweighted list with a fourth column.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents lists the loader must refuse instead of allocating or handing to the shortest-path searches: the largest `int` ID, a lone edge to a 2-billion ID, and negative or NaN costs.
+     */
+    for (const auto* const rejected_text : {"0 2147483647\n", "0 2000000000\n", "0 1 4\n1 2 -3\n"}) {
+        {
+            std::ofstream rejected_file {rejected_path, std::ios::binary | std::ios::trunc};
+
+            rejected_file << rejected_text;
+        }
+
+        if (Containers::Graph::loadEdgeList<EdgeWeightPolicy::weighted>(rejected_path)) {
+            std::print(std::cerr, "Unexpected success loading the list \"{}\".\n", rejected_text);
+            return 1;
+        }
+    }
+
+    {
+        std::ofstream rejected_file {rejected_path, std::ios::binary | std::ios::trunc};
+
+        rejected_file << "0 1 nan\n";
+    }
+
+    if (Containers::Graph::loadEdgeList<EdgeWeightPolicy::weighted, double>(rejected_path)) {
+        std::print(std::cerr, "Unexpected success loading a list with a NaN cost.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a generated list large enough to split over several parsing workers, which must agree with a single-threaded load.
+     */
+    {
+        std::ofstream large_file {large_path, std::ios::binary};
+        unsigned int lcg_state = 3U;
+
+        for (auto line = 0; line < 50000; line++) {
+            lcg_state = lcg_state * 1103515245U + 12345U;
+            const auto from = (lcg_state >> 8) % 5000U;
+            lcg_state = lcg_state * 1103515245U + 12345U;
+
+            large_file << from << ' ' << (lcg_state >> 8) % 5000U << ' ' << line % 97 << '\n';
+        }
+    }
+
+    const auto serial_load = Containers::Graph::loadEdgeList<EdgeWeightPolicy::weighted, short>(large_path, {.sort_neighbors = true, .thread_count = 1});
+
+    for (const auto worker_count : {2U, 7U}) {
+        const auto parallel_load = Containers::Graph::loadEdgeList<EdgeWeightPolicy::weighted, short>(large_path, {.sort_neighbors = true, .thread_count = worker_count});
+
+        if (not serial_load or not parallel_load or serial_load->edgeCount() != 50000 or not std::ranges::equal(serial_load->offsets(), parallel_load->offsets()) or not std::ranges::equal(serial_load->targets(), parallel_load->targets())) {
+            std::print(std::cerr, "Unexpected mismatch between serial & {}-worker loads.\n", worker_count);
+            return 1;
+        }
+    }
+
+    std::filesystem::remove(roads_path);
+    std::filesystem::remove(broken_path);
+    std::filesystem::remove(real_costs_path);
+    std::filesystem::remove(large_path);
+    std::filesystem::remove(rejected_path);
+}
@@ -0,0 +1,175 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <print>
+#include <vector>
+#include "containers/graph.hpp"
+#include "containers/graph_file.hpp"
+#include "algorithms/traversals.hpp"
+#include "algorithms/shortest_paths.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    const auto scratch_dir = std::filesystem::temp_directory_path();
+    const auto weighted_path = scratch_dir / "derklib_test_weighted.dgraph";
+    const auto unweighted_path = scratch_dir / "derklib_test_unweighted.dgraph";
+    const auto crafted_path = scratch_dir / "derklib_test_crafted.dgraph";
+
+    /**
+     * @brief Represents a weighted ring of 50 nodes with shortcut edges every 7 nodes.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, long> ring;
+
+    for (auto node = 0L; node < 50L; node++) {
+        ring.add(node * 100L);
+    }
+
+    for (auto node = 0; node < 50; node++) {
+        ring.connectAt(node, (node + 1) % 50, 2, EdgeDirection::two_way);
+
+        if (node % 7 == 0) {
+            ring.connectAt(node, (node + 10) % 50, 9, EdgeDirection::one_way);
+        }
+    }
+
+    const auto frozen_ring = ring.freeze();
+
+    if (not Containers::Graph::saveGraphFile(frozen_ring, weighted_path)) {
+        std::print(std::cerr, "Unexpected failure of saving the weighted ring.\n");
+        return 1;
+    }
+
+    {
+        auto mapped_ring = Containers::Graph::MappedGraph<EdgeWeightPolicy::weighted, long>::open(weighted_path);
+
+        if (not mapped_ring or mapped_ring->size() != 50 or mapped_ring->edgeCount() != frozen_ring.edgeCount() or mapped_ring->itemAt(49) != 4900L) {
+            std::print(std::cerr, "Unexpected shape of the mapped weighted ring.\n");
+            return 1;
+        }
+
+        if (Algorithms::Graph::searchDijkstra(*mapped_ring, 3).distances != Algorithms::Graph::searchDijkstra(frozen_ring, 3).distances) {
+            std::print(std::cerr, "Unexpected Dijkstra mismatch between mapped & in-memory rings.\n");
+            return 1;
+        }
+
+        auto moved_ring = std::move(mapped_ring.value());
+
+        if (moved_ring.indexOf(700L) != 7 or moved_ring.costsOf(7).size() != 3) {
+            std::print(std::cerr, "Unexpected lookup result from the moved mapped ring.\n");
+            return 1;
+        }
+    }
+
+    if (Containers::Graph::MappedGraph<EdgeWeightPolicy::weighted, int>::open(weighted_path) or Containers::Graph::MappedGraph<EdgeWeightPolicy::unweighted, long>::open(weighted_path)) {
+        std::print(std::cerr, "Unexpected success of mapping the weighted ring as another graph type.\n");
+        return 1;
+    }
+
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> chain;
+
+    for (auto node = 0; node < 10; node++) {
+        chain.add(node);
+
+        if (node > 0) {
+            chain.connectAt(node - 1, node, EdgeDirection::one_way);
+        }
+    }
+
+    if (not Containers::Graph::saveGraphFile(chain.freeze(), unweighted_path)) {
+        std::print(std::cerr, "Unexpected failure of saving the chain.\n");
+        return 1;
+    }
+
+    if (const auto mapped_chain = Containers::Graph::MappedGraph<EdgeWeightPolicy::unweighted, int>::open(unweighted_path); not mapped_chain or Algorithms::Graph::searchBFS(*mapped_chain, 0).levels[9] != 9) {
+        std::print(std::cerr, "Unexpected BFS levels over the mapped chain.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a crafted header whose offsets section starts 4 bytes below 2^64, so an unchecked `offsets_at + size` wraps to 0 & passes every bound.
+     */
+    {
+        const Containers::Graph::GraphFileHeader crafted_header {
+            .magic = Containers::Graph::GraphFileHeader::expected_magic,
+            .version = Containers::Graph::GraphFileHeader::expected_version,
+            .byte_order = Containers::Graph::GraphFileHeader::expected_byte_order,
+            .path_policy = static_cast<std::uint32_t>(EdgeWeightPolicy::unweighted),
+            .item_size = sizeof(int),
+            .node_count = 0,
+            .edge_count = 0,
+            .offsets_at = UINT64_MAX - 3,
+            .targets_at = sizeof(Containers::Graph::GraphFileHeader),
+            .costs_at = sizeof(Containers::Graph::GraphFileHeader),
+            .items_at = sizeof(Containers::Graph::GraphFileHeader),
+            .file_size = sizeof(Containers::Graph::GraphFileHeader)
+        };
+        std::ofstream crafted_file {crafted_path, std::ios::binary};
+
+        crafted_file.write(reinterpret_cast<const char*>(&crafted_header), sizeof(crafted_header));
+    }
+
+    if (Containers::Graph::MappedGraph<EdgeWeightPolicy::unweighted, int>::open(crafted_path)) {
+        std::print(std::cerr, "Unexpected success of mapping a header with a wrapping section offset.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents copies of the saved chain with one field overwritten in place: a section start inside the header, an interior offset that runs backwards, and a target past the last node. Each keeps a consistent header, so only the overlap check & the body scan can reject them.
+     */
+    {
+        Containers::Graph::GraphFileHeader chain_header {};
+
+        {
+            std::ifstream chain_file {unweighted_path, std::ios::binary};
+
+            chain_file.read(reinterpret_cast<char*>(&chain_header), sizeof(chain_header));
+        }
+
+        auto openPatchedChain = [&](std::uint64_t at, const auto& value) {
+            std::filesystem::copy_file(unweighted_path, crafted_path, std::filesystem::copy_options::overwrite_existing);
+
+            {
+                std::fstream crafted_file {crafted_path, std::ios::binary | std::ios::in | std::ios::out};
+
+                crafted_file.seekp(static_cast<std::streamoff>(at));
+                crafted_file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+
+            return Containers::Graph::MappedGraph<EdgeWeightPolicy::unweighted, int>::open(crafted_path).has_value();
+        };
+
+        if (openPatchedChain(offsetof(Containers::Graph::GraphFileHeader, offsets_at), std::uint64_t {0})) {
+            std::print(std::cerr, "Unexpected success of mapping an offsets section that overlaps the header.\n");
+            return 1;
+        }
+
+        if (openPatchedChain(chain_header.offsets_at + 5 * sizeof(int), 0)) {
+            std::print(std::cerr, "Unexpected success of mapping decreasing offsets.\n");
+            return 1;
+        }
+
+        if (openPatchedChain(chain_header.targets_at + 4 * sizeof(int), 10)) {
+            std::print(std::cerr, "Unexpected success of mapping an out-of-range target.\n");
+            return 1;
+        }
+
+        if (not openPatchedChain(chain_header.targets_at + 4 * sizeof(int), 9)) {
+            std::print(std::cerr, "Unexpected failure of mapping an in-range target.\n");
+            return 1;
+        }
+    }
+
+    std::filesystem::remove(weighted_path);
+    std::filesystem::remove(unweighted_path);
+    std::filesystem::remove(crafted_path);
+
+    if (Containers::Graph::MappedGraph<EdgeWeightPolicy::unweighted, int>::open(unweighted_path)) {
+        std::print(std::cerr, "Unexpected success of mapping a missing file.\n");
+        return 1;
+    }
+}
@@ -1,7 +1,12 @@
+#include <algorithm>
 #include <type_traits>
 #include <iostream>
 #include <print>
+#include <ranges>
+#include <span>
+#include <string>
 #include <vector>
+#include "containers/arena.hpp"
 #include "containers/graph.hpp"
 #include "algorithms/traversals.hpp"
 
@@ -69,4 +74,398 @@ int main() {
         std::print(std::cerr, "Unexpected mismatch in result: \n");
         return 1;
     }
+
+    const auto frozen_tree = valued_tree.freeze();
+
+    if (frozen_tree.size() != 4 or frozen_tree.edgeCount() != 3) {
+        std::print(std::cerr, "Unexpected shape of frozen_tree: {} nodes, {} edges\n", frozen_tree.size(), frozen_tree.edgeCount());
+        return 1;
+    }
+
+    auto csr_bfs_results = Algorithms::Graph::traverseBFS(frozen_tree, [](int arg) noexcept {
+        return arg;
+    });
+
+    if (not checkTraversalResults(csr_bfs_results, {10, 15, 3, -8})) {
+        std::print(std::cerr, "Unexpected mismatch in CSR traversal result.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a fork where depth-first & breadth-first orders differ: 0 -> {2, 1} (newest first), 2 -> 3, 1 -> 4.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> fork;
+
+    for (auto node = 0; node < 5; node++) {
+        fork.add(node);
+    }
+
+    fork.connectAt(0, 1, EdgeDirection::one_way);
+    fork.connectAt(0, 2, EdgeDirection::one_way);
+    fork.connectAt(2, 3, EdgeDirection::one_way);
+    fork.connectAt(1, 4, EdgeDirection::one_way);
+
+    if (not checkTraversalResults(Algorithms::Graph::traverseDFS(fork, [](int arg) noexcept { return arg; }), {0, 2, 3, 1, 4})) {
+        std::print(std::cerr, "Unexpected preorder from traverseDFS over fork.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a one-way path of a million nodes, deep enough to overflow a recursive DFS.
+     */
+    constexpr auto path_length = 1000000;
+    std::vector<int> path_nodes (path_length);
+    std::vector<Containers::Graph::IndexEdge> path_links;
+
+    for (auto node = 0; node < path_length; node++) {
+        path_nodes[node] = node;
+
+        if (node + 1 < path_length) {
+            path_links.emplace_back(node, node + 1);
+        }
+    }
+
+    const auto long_path = Containers::Graph::buildCsrGraph(std::span {path_nodes}, std::span {path_links});
+
+    if (const auto deep_visits = Algorithms::Graph::traverseDFS(*long_path, [](int arg) noexcept { return arg; }); deep_visits.size() != path_length or deep_visits.back() != path_length - 1) {
+        std::print(std::cerr, "Unexpected traverseDFS visits over a deep path.\n");
+        return 1;
+    }
+
+#if defined(__cpp_lib_generator)
+    std::vector<int> lazy_fork_visits;
+
+    for (const auto node : Algorithms::Graph::lazyDFS(fork, 0)) {
+        lazy_fork_visits.emplace_back(node);
+    }
+
+    if (not checkTraversalResults(lazy_fork_visits, {0, 2, 3, 1, 4})) {
+        std::print(std::cerr, "Unexpected preorder from lazyDFS over fork.\n");
+        return 1;
+    }
+
+    lazy_fork_visits.clear();
+
+    for (const auto node : Algorithms::Graph::lazyBFS(fork, 0) | std::views::take(3)) {
+        lazy_fork_visits.emplace_back(node);
+    }
+
+    if (not checkTraversalResults(lazy_fork_visits, {0, 2, 1})) {
+        std::print(std::cerr, "Unexpected prefix from lazyBFS over fork.\n");
+        return 1;
+    }
+
+    /// NOTE: the search must stop right at the target instead of walking the remaining path.
+    auto deep_search = Algorithms::Graph::lazyDFS(*long_path, 0);
+
+    if (const auto found = std::ranges::find(deep_search, 42); found == deep_search.end() or *found != 42) {
+        std::print(std::cerr, "Unexpected early-terminating lazyDFS lookup.\n");
+        return 1;
+    }
+#endif
+
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, char> route_map;
+
+    route_map.add('A');
+    route_map.add('B');
+    route_map.add('C');
+
+    if (not route_map.connect('A', 'B', 4, EdgeDirection::two_way) or not route_map.connect('B', 'C', 7, EdgeDirection::one_way)) {
+        std::print(std::cerr, "Unexpected failure of connecting route_map.\n");
+        return 1;
+    }
+
+    const auto frozen_routes = route_map.freeze();
+    const auto b_targets = frozen_routes.targetsOf(1);
+    const auto b_costs = frozen_routes.costsOf(1);
+
+    if (frozen_routes.edgeCount() != 3 or b_targets.size() != 2 or b_targets[0] != 2 or b_costs[0] != 7 or b_targets[1] != 0 or b_costs[1] != 4) {
+        std::print(std::cerr, "Unexpected weighted CSR layout for 'B'.\n");
+        return 1;
+    }
+
+    auto b_cost_total = 0;
+
+    for (const auto& [cost, destination] : frozen_routes.neighbors(1)) {
+        b_cost_total += cost * (destination + 1);
+    }
+
+    for (const auto& [cost, destination] : route_map.neighbors(1)) {
+        b_cost_total -= cost * (destination + 1);
+    }
+
+    if (b_cost_total != 0 or route_map.neighborsOf('B').size() != 2 or *route_map.neighborsOf('B')[0] != 'C') {
+        std::print(std::cerr, "Unexpected mismatch between weighted Graph & CSR neighbor views.\n");
+        return 1;
+    }
+
+    route_map.connectAt(2, 0, 1, EdgeDirection::one_way);
+
+    if (const auto c_edges = route_map.neighbors(2); c_edges.empty() or c_edges.front() != Containers::Graph::WeightedEdge {1, 0}) {
+        std::print(std::cerr, "Unexpected adjacency after index-based connectAt.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a 5-cycle 0 - 1 - 2 - 3 - 4 - 0 with two-way edges, plus an isolated node 5.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> ring;
+
+    for (auto node = 0; node < 6; node++) {
+        ring.add(node);
+    }
+
+    for (auto node = 0; node < 5; node++) {
+        ring.connectAt(node, (node + 1) % 5, EdgeDirection::two_way);
+    }
+
+    if (auto ring_visits = Algorithms::Graph::traverseBFS(ring, [](int arg) noexcept { return arg; }); ring_visits.size() != 5) {
+        std::print(std::cerr, "Unexpected visit count {} of cyclic traverseBFS.\n", ring_visits.size());
+        return 1;
+    }
+
+    const auto ring_search = Algorithms::Graph::searchBFS(ring.freeze(), 0);
+
+    if (not checkTraversalResults(ring_search.levels, {0, 1, 2, 2, 1, Algorithms::Graph::no_node})) {
+        std::print(std::cerr, "Unexpected levels from searchBFS over ring.\n");
+        return 1;
+    }
+
+    if (not checkTraversalResults(ring_search.parents, {Algorithms::Graph::no_node, 0, 1, 4, 0, Algorithms::Graph::no_node})) {
+        std::print(std::cerr, "Unexpected parents from searchBFS over ring.\n");
+        return 1;
+    }
+
+    if (ring_search.order.size() != 5 or ring_search.order.front() != 0 or not Algorithms::Graph::searchBFS(ring, 6).order.empty()) {
+        std::print(std::cerr, "Unexpected visit order from searchBFS over ring.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a pseudo-random, hub-heavy one-way graph: each node links to a few earlier nodes, biased toward low indices.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> hub_graph;
+    unsigned int lcg_state = 12345U;
+
+    for (auto node = 0; node < 2000; node++) {
+        hub_graph.add(node);
+    }
+
+    for (auto node = 1; node < 2000; node++) {
+        for (auto link = 0; link < 4; link++) {
+            lcg_state = lcg_state * 1103515245U + 12345U;
+            const auto target = static_cast<int>((lcg_state >> 8) % static_cast<unsigned int>(node));
+
+            hub_graph.connectAt(node, target / (link + 1), EdgeDirection::one_way);
+            hub_graph.connectAt(target / (link + 1), node, EdgeDirection::one_way);
+        }
+    }
+
+    const auto hub_csr = hub_graph.freeze();
+    const auto hub_serial = Algorithms::Graph::searchBFS(hub_csr, 7);
+    const auto hub_hybrid = Algorithms::Graph::searchBFSDirectionOpt(hub_graph, 7);
+
+    if (not checkTraversalResults(hub_hybrid.levels, hub_serial.levels) or hub_hybrid.order.size() != hub_serial.order.size()) {
+        std::print(std::cerr, "Unexpected mismatch between direction-optimizing & serial BFS levels.\n");
+        return 1;
+    }
+
+    for (const auto node : hub_hybrid.order) {
+        const auto parent = hub_hybrid.parents[node];
+
+        if (node == 7) {
+            continue;
+        }
+
+        const auto parent_targets = hub_csr.targetsOf(parent);
+
+        if (hub_hybrid.levels[parent] + 1 != hub_hybrid.levels[node] or std::find(parent_targets.begin(), parent_targets.end(), node) == parent_targets.end()) {
+            std::print(std::cerr, "Unexpected BFS-tree parent {} of node {} from direction-optimizing BFS.\n", parent, node);
+            return 1;
+        }
+    }
+
+    for (const auto worker_count : {1U, 2U, 4U}) {
+        const auto hub_parallel = Algorithms::Graph::searchBFSParallel(hub_csr, 7, worker_count);
+
+        if (not checkTraversalResults(hub_parallel.levels, hub_serial.levels) or hub_parallel.order.size() != hub_serial.order.size()) {
+            std::print(std::cerr, "Unexpected mismatch between parallel ({} workers) & serial BFS levels.\n", worker_count);
+            return 1;
+        }
+
+        for (const auto node : hub_parallel.order) {
+            if (const auto parent = hub_parallel.parents[node]; node != 7 and hub_parallel.levels[parent] + 1 != hub_parallel.levels[node]) {
+                std::print(std::cerr, "Unexpected BFS-tree parent {} of node {} from parallel BFS.\n", parent, node);
+                return 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Bulk-builds the same hub graph from an edge list, plus duplicate edges that the deduplicating build must drop.
+     */
+    std::vector<int> hub_nodes (2000);
+    std::vector<Containers::Graph::IndexEdge> hub_edges;
+
+    for (auto node = 0; node < 2000; node++) {
+        hub_nodes[node] = node;
+
+        for (const auto adj_index : hub_csr.targetsOf(node)) {
+            hub_edges.emplace_back(node, adj_index);
+            hub_edges.emplace_back(node, adj_index);
+        }
+    }
+
+    for (const auto worker_count : {1U, 3U}) {
+        const auto bulk_hub = Containers::Graph::buildCsrGraph(std::span {hub_nodes}, std::span {hub_edges}, {.sort_neighbors = true, .deduplicate = true, .thread_count = worker_count});
+
+        if (not bulk_hub or bulk_hub->size() != hub_csr.size()) {
+            std::print(std::cerr, "Unexpected failure of bulk-building hub graph.\n");
+            return 1;
+        }
+
+        for (auto node = 0; node < 2000; node++) {
+            std::vector<int> expected_targets (hub_csr.targetsOf(node).begin(), hub_csr.targetsOf(node).end());
+            const auto bulk_targets = bulk_hub->targetsOf(node);
+
+            std::sort(expected_targets.begin(), expected_targets.end());
+            expected_targets.erase(std::unique(expected_targets.begin(), expected_targets.end()), expected_targets.end());
+
+            if (not std::equal(bulk_targets.begin(), bulk_targets.end(), expected_targets.cbegin(), expected_targets.cend())) {
+                std::print(std::cerr, "Unexpected bulk-built neighbors of hub node {}.\n", node);
+                return 1;
+            }
+        }
+    }
+
+    const std::vector<char> bulk_towns {'A', 'B', 'C'};
+    const std::vector<Containers::Graph::IndexCostEdge> bulk_roads {{0, 1, 9}, {0, 1, 4}, {1, 2, 7}};
+    const auto bulk_route_map = Containers::Graph::buildCsrGraph(std::span {bulk_towns}, std::span {bulk_roads}, {.direction = EdgeDirection::two_way, .deduplicate = true});
+
+    if (not bulk_route_map or bulk_route_map->edgeCount() != 4 or bulk_route_map->costsOf(0).front() != 4 or bulk_route_map->targetsOf(1).size() != 2) {
+        std::print(std::cerr, "Unexpected layout of bulk-built weighted route map.\n");
+        return 1;
+    }
+
+    const std::vector<Containers::Graph::IndexEdge> broken_edges {{0, 3}};
+
+    if (Containers::Graph::buildCsrGraph(std::span {bulk_towns}, std::span {broken_edges})) {
+        std::print(std::cerr, "Unexpected success of bulk-building with an out-of-range edge.\n");
+        return 1;
+    }
+
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, std::string, Containers::Graph::LookupPolicy::hashed> word_chain;
+
+    word_chain.add("cat");
+    word_chain.add("cot");
+    word_chain.add("dot");
+
+    if (word_chain.add("cot") or word_chain.size() != 3) {
+        std::print(std::cerr, "Unexpected duplicate insertion into hashed word_chain.\n");
+        return 1;
+    }
+
+    if (not word_chain.remove("cat") or word_chain.remove("cat")) {
+        std::print(std::cerr, "Unexpected result of removing \"cat\" from hashed word_chain.\n");
+        return 1;
+    }
+
+    if (not word_chain.connect("cot", "dot", EdgeDirection::one_way) or word_chain.connect("cat", "dot", EdgeDirection::one_way)) {
+        std::print(std::cerr, "Unexpected connect result after hashed index rebuild.\n");
+        return 1;
+    }
+
+    if (word_chain.liveCount() != 2 or word_chain.compact() != std::vector<int> {-1, 0, 1} or word_chain.size() != 2 or word_chain.indexOf("dot") != 1) {
+        std::print(std::cerr, "Unexpected renumbering after compacting word_chain.\n");
+        return 1;
+    }
+
+    auto chain_results = Algorithms::Graph::traverseBFS(word_chain, [](const std::string& arg) {
+        return arg.size();
+    });
+
+    if (not checkTraversalResults(chain_results, {3UL, 3UL})) {
+        std::print(std::cerr, "Unexpected mismatch in hashed word_chain traversal.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a weighted star: hub 0 with two-way spokes to 1..5. Removing spokes must neither shift the others' indices nor leave stale edges behind.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, int, Containers::Graph::LookupPolicy::hashed> star;
+
+    for (auto node = 0; node < 6; node++) {
+        star.add(node * 10);
+    }
+
+    for (auto spoke = 1; spoke < 6; spoke++) {
+        star.connectAt(0, spoke, spoke, EdgeDirection::two_way);
+    }
+
+    if (not star.remove(20) or star.remove(20) or not star.removeAt(4) or star.size() != 6 or star.liveCount() != 4 or star.indexOf(50) != 5) {
+        std::print(std::cerr, "Unexpected tombstoning result over star.\n");
+        return 1;
+    }
+
+    if (std::ranges::distance(star.neighbors(0)) != 3 or star.neighborsOf(0).size() != 3 or star.freeze().edgeCount() != 6) {
+        std::print(std::cerr, "Unexpected live adjacency of star's hub after removals.\n");
+        return 1;
+    }
+
+    if (star.add(20); star.indexOf(20) != 6 or star.tombstoneCount() != 2) {
+        std::print(std::cerr, "Unexpected slot for re-added item in star.\n");
+        return 1;
+    }
+
+    if (star.compact() != std::vector<int> {0, 1, -1, 2, -1, 3, 4} or star.size() != 5 or star.tombstoneCount() != 0) {
+        std::print(std::cerr, "Unexpected renumbering after compacting star.\n");
+        return 1;
+    }
+
+    for (const auto& [cost, spoke] : star.neighbors(0)) {
+        if (star.itemAt(spoke) != cost * 10 or star.neighbors(spoke).front() != Containers::Graph::WeightedEdge {cost, 0}) {
+            std::print(std::cerr, "Unexpected stale spoke {} of compacted star.\n", spoke);
+            return 1;
+        }
+    }
+
+    /**
+     * @brief Rebuilds the hub graph with its edge nodes drawn from an arena, which must traverse identically & reuse its chunks after a reset.
+     */
+    Containers::Memory::Arena edge_arena {4096};
+    std::size_t first_round_chunks = 0;
+
+    for (auto round = 0; round < 2; round++) {
+        Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int, Containers::Graph::LookupPolicy::linear_scan, Containers::Memory::ArenaAllocator> arena_hub {Containers::Memory::ArenaAllocator<int> {edge_arena}};
+
+        for (auto node = 0; node < 2000; node++) {
+            arena_hub.add(node);
+        }
+
+        for (const auto& [from, to] : hub_edges) {
+            arena_hub.connectAt(from, to, EdgeDirection::one_way);
+        }
+
+        if (not checkTraversalResults(Algorithms::Graph::searchBFS(arena_hub, 7).levels, hub_serial.levels) or edge_arena.bytesUsed() < hub_edges.size() * sizeof(int)) {
+            std::print(std::cerr, "Unexpected BFS levels or arena usage over arena-backed hub graph.\n");
+            return 1;
+        }
+
+        const auto chunks_before = edge_arena.chunkCount();
+
+        if (round == 1 and chunks_before != first_round_chunks) {
+            std::print(std::cerr, "Unexpected growth of arena from {} to {} chunks after reset.\n", first_round_chunks, chunks_before);
+            return 1;
+        }
+
+        first_round_chunks = chunks_before;
+
+        arena_hub = decltype(arena_hub) {Containers::Memory::ArenaAllocator<int> {edge_arena}};
+        edge_arena.reset();
+
+        if (edge_arena.bytesUsed() != 0 or edge_arena.chunkCount() != chunks_before) {
+            std::print(std::cerr, "Unexpected arena state after reset.\n");
+            return 1;
+        }
+    }
 }
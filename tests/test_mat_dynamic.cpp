@@ -0,0 +1,114 @@
+#include "mathematics/dynamic_matrices.hpp"
+#include <cstdint>
+#include <iostream>
+#include <print>
+#include <stdexcept>
+#include <utility>
+
+int main() {
+    using namespace DerkLib::Mathematics;
+
+    /**
+     * @brief Represents a 2x3 matrix of:
+     * [1 2 3],
+     * [4 5 6]
+     */
+    Matrices::DynamicMatrix<int> wide (2, 3);
+
+    for (auto row = 0; row < 2; row++) {
+        for (auto col = 0; col < 3; col++) {
+            wide[row, col] = row * 3 + col + 1;
+        }
+    }
+
+    if (wide.area() != 6UL or wide.isSquare()) {
+        std::print(std::cerr, "Unexpected area {} or squareness of wide!\n", wide.area());
+        return 1;
+    }
+
+    if (reinterpret_cast<std::uintptr_t>(wide.elements().data()) % 64 != 0) {
+        std::print(std::cerr, "Unexpected misaligned storage of wide!\n");
+        return 1;
+    }
+
+    if (const auto flat = wide.elements(); flat[4] != 5) {
+        std::print(std::cerr, "Unexpected non row-major element {} at flat index 4!\n", flat[4]);
+        return 1;
+    }
+
+    try {
+        [[maybe_unused]] auto& bad = wide.at(2, 0);
+        std::print(std::cerr, "Unexpected success of out-of-bounds at(2, 0)!\n");
+        return 1;
+    } catch (const std::logic_error&) {}
+
+    /// NOTE: chops out [[5, 6]] from the second row.
+    if (const auto chopped = wide.chop(1, 1, 1, 2); chopped.rows() != 1UL or chopped.cols() != 2UL or chopped[0, 0] != 5 or chopped[0, 1] != 6) {
+        std::print(std::cerr, "Unexpected contents of chopped sub-matrix!\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a 3x2 matrix of all 1's, so wide * tall sums the rows of wide: [[6, 6], [15, 15]].
+     */
+    Matrices::DynamicMatrix<int> tall (3, 2, 1);
+    Matrices::Matrix<int, 2, 2> expected_product {};
+    expected_product[0, 0] = 6;
+    expected_product[0, 1] = 6;
+    expected_product[1, 0] = 15;
+    expected_product[1, 1] = 15;
+
+    if (const auto product = wide * tall; product != expected_product) {
+        std::print(std::cerr, "Unexpected mismatch of wide * tall & expected_product!\n");
+        return 1;
+    }
+
+    try {
+        [[maybe_unused]] const auto bad_product = wide * wide;
+        std::print(std::cerr, "Unexpected success of incompatible wide * wide!\n");
+        return 1;
+    } catch (const std::logic_error&) {}
+
+    /// NOTE: round-trips through the fixed-size matrix & checks element-wise ops against it.
+    Matrices::Matrix<int, 2, 2> transform_double {Matrices::MatrixDefaultingOpt::identity, 2};
+    Matrices::DynamicMatrix<int> dyn_double {transform_double};
+    Matrices::DynamicMatrix<int> dyn_identity (2, 2, Matrices::MatrixDefaultingOpt::identity, 1);
+
+    dyn_identity += dyn_identity;
+
+    if (dyn_identity != dyn_double or dyn_identity != transform_double) {
+        std::print(std::cerr, "Unexpected mismatch of dyn_identity & the doubled identity!\n");
+        return 1;
+    }
+
+    dyn_identity *= 3;
+    dyn_identity -= dyn_double;
+
+    if (auto fixed_back = dyn_identity.toFixed<2, 2>(); not fixed_back or (*fixed_back)[0, 0] != 4 or (*fixed_back)[0, 1] != 0) {
+        std::print(std::cerr, "Unexpected result of dyn_identity.toFixed<2, 2>()!\n");
+        return 1;
+    }
+
+    if (dyn_identity.toFixed<2, 3>()) {
+        std::print(std::cerr, "Unexpected success of toFixed on mismatched dimensions!\n");
+        return 1;
+    }
+
+    /// NOTE: a 1024x1024 double matrix, which the fixed-size type cannot hold on the stack, moves without copying its block.
+    Matrices::DynamicMatrix<double> big (1024, 1024, Matrices::MatrixDefaultingOpt::identity, 1.0);
+    const auto* big_block = big.elements().data();
+    auto moved = std::move(big);
+
+    if (moved.elements().data() != big_block or big.area() != 0UL or moved[1023, 1023] != 1.0) {
+        std::print(std::cerr, "Unexpected state after moving the 1024x1024 matrix!\n");
+        return 1;
+    }
+
+    auto copied = moved;
+    copied[0, 1] = 2.0;
+
+    if (copied == moved or copied.elements().data() == moved.elements().data()) {
+        std::print(std::cerr, "Unexpected shared state between copied & moved!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,123 @@
+#include "mathematics/dynamic_matrices.hpp"
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <print>
+#include <utility>
+#include <vector>
+
+namespace {
+    using namespace DerkLib::Mathematics;
+
+    /// NOTE: plain i-j-k reference product, matching the triple loop `Matrix::operator*` uses for small sizes.
+    template <typename T>
+    [[nodiscard]] Matrices::DynamicMatrix<T> referenceProduct(const Matrices::DynamicMatrix<T>& lhs, const Matrices::DynamicMatrix<T>& rhs) {
+        Matrices::DynamicMatrix<T> ans (lhs.rows(), rhs.cols());
+
+        for (auto row = 0; row < static_cast<int>(lhs.rows()); row++) {
+            for (auto col = 0; col < static_cast<int>(rhs.cols()); col++) {
+                for (auto depth_i = 0; depth_i < static_cast<int>(lhs.cols()); depth_i++) {
+                    ans[row, col] += lhs[row, depth_i] * rhs[depth_i, col];
+                }
+            }
+        }
+
+        return ans;
+    }
+
+    template <typename T>
+    [[nodiscard]] Matrices::DynamicMatrix<T> patterned(std::size_t rows, std::size_t cols, int seed) {
+        Matrices::DynamicMatrix<T> arg (rows, cols);
+
+        for (auto row = 0; row < static_cast<int>(rows); row++) {
+            for (auto col = 0; col < static_cast<int>(cols); col++) {
+                arg[row, col] = static_cast<T>((row * 7 + col * 3 + seed) % 11 - 5);
+            }
+        }
+
+        return arg;
+    }
+}
+
+int main() {
+    /// NOTE: ragged sizes leave partial register tiles & partial cache blocks on every edge.
+    const auto lhs = patterned<int>(67, 45, 1);
+    const auto rhs = patterned<int>(45, 53, 2);
+    const auto expected = referenceProduct(lhs, rhs);
+
+    if (const auto product = lhs * rhs; product != expected) {
+        std::print(std::cerr, "Unexpected mismatch of blocked 67x45 * 45x53 int product!\n");
+        return 1;
+    }
+
+    /// NOTE: tiny, unaligned block sizes force every loop level to iterate many times.
+    for (const auto blocking : {Matrices::GemmBlocking {.row_block = 5, .depth_block = 7, .col_block = 3}, Matrices::GemmBlocking {.row_block = 0, .depth_block = 0, .col_block = 0}}) {
+        Matrices::DynamicMatrix<int> product (lhs.rows(), rhs.cols());
+
+        Matrices::multiplyBlocked<int>(lhs.rows(), lhs.cols(), rhs.cols(), [&lhs](std::size_t row, std::size_t depth_i) {
+            return lhs[static_cast<int>(row), static_cast<int>(depth_i)];
+        }, [&rhs](std::size_t depth_i, std::size_t col) {
+            return rhs[static_cast<int>(depth_i), static_cast<int>(col)];
+        }, [&product](std::size_t row, std::size_t col) -> int& {
+            return product[static_cast<int>(row), static_cast<int>(col)];
+        }, blocking);
+
+        if (product != expected) {
+            std::print(std::cerr, "Unexpected mismatch of product with blocking {}x{}x{}!\n", blocking.row_block, blocking.depth_block, blocking.col_block);
+            return 1;
+        }
+    }
+
+    /// NOTE: the dispatched micro-kernel, AVX2 + FMA where available, must agree with the baseline one on the same packed panels.
+    {
+        constexpr auto tile_area = Matrices::Impl::tile_rows * Matrices::Impl::tile_cols<double>;
+        constexpr std::size_t tile_depth = 37;
+        std::vector<double> packed_lhs (Matrices::Impl::tile_rows * tile_depth);
+        std::vector<double> packed_rhs (Matrices::Impl::tile_cols<double> * tile_depth);
+        std::vector<double> baseline_tile (tile_area);
+        std::vector<double> dispatched_tile (tile_area);
+
+        for (auto elem_idx = 0UL; elem_idx < packed_lhs.size(); elem_idx++) {
+            packed_lhs[elem_idx] = static_cast<double>(static_cast<int>(elem_idx % 9) - 4);
+        }
+
+        for (auto elem_idx = 0UL; elem_idx < packed_rhs.size(); elem_idx++) {
+            packed_rhs[elem_idx] = static_cast<double>(static_cast<int>(elem_idx % 5) - 2) * 0.5;
+        }
+
+        Matrices::Impl::accumulateTileBaseline(packed_lhs.data(), packed_rhs.data(), tile_depth, baseline_tile.data());
+        Matrices::Impl::tileKernel<double>()(packed_lhs.data(), packed_rhs.data(), tile_depth, dispatched_tile.data());
+
+        if (baseline_tile != dispatched_tile) {
+            std::print(std::cerr, "Unexpected mismatch between the baseline & dispatched micro-kernels!\n");
+            return 1;
+        }
+    }
+
+    /// NOTE: small integer-valued doubles keep the blocked sums exact despite the reordered additions.
+    const auto lhs_f = patterned<double>(130, 129, 3);
+    const auto rhs_f = patterned<double>(129, 131, 4);
+
+    if (const auto product = lhs_f * rhs_f; product != referenceProduct(lhs_f, rhs_f)) {
+        std::print(std::cerr, "Unexpected mismatch of blocked 130x129 * 129x131 double product!\n");
+        return 1;
+    }
+
+    /// NOTE: a fixed-size product large enough to take the blocked path, compared with its dynamic counterpart.
+    auto fixed_lhs = std::make_unique<Matrices::Matrix<int, 40, 36>>();
+    auto fixed_rhs = std::make_unique<Matrices::Matrix<int, 36, 33>>();
+    const auto dyn_lhs = patterned<int>(40, 36, 5);
+    const auto dyn_rhs = patterned<int>(36, 33, 6);
+
+    /// NOTE: the blocked path allocates packing buffers, so only products below its volume may be `noexcept`.
+    static_assert(not noexcept(*fixed_lhs * *fixed_rhs));
+    static_assert(noexcept(std::declval<Matrices::Matrix<int, 4, 4>&>() * std::declval<const Matrices::Matrix<int, 4, 4>&>()));
+
+    *fixed_lhs = *dyn_lhs.toFixed<40, 36>();
+    *fixed_rhs = *dyn_rhs.toFixed<36, 33>();
+
+    if (const auto fixed_product = *fixed_lhs * *fixed_rhs; referenceProduct(dyn_lhs, dyn_rhs) != fixed_product) {
+        std::print(std::cerr, "Unexpected mismatch of blocked fixed-size 40x36 * 36x33 product!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,146 @@
+#include "mathematics/dynamic_matrices.hpp"
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <print>
+#include <vector>
+
+namespace {
+    using namespace DerkLib::Mathematics;
+
+    template <typename T>
+    [[nodiscard]] std::vector<T> patterned(std::size_t count, int seed) {
+        std::vector<T> values (count);
+
+        for (auto elem_idx = 0UL; elem_idx < count; elem_idx++) {
+            values[elem_idx] = static_cast<T>(static_cast<int>((elem_idx * 7 + static_cast<std::size_t>(seed)) % 23) - 11);
+        }
+
+        return values;
+    }
+
+    /**
+     * @brief Checks one kernel set against the scalar loops over every length up to 3 AVX-512 vectors plus a tail, & at unaligned offsets.
+     */
+    template <typename T>
+    [[nodiscard]] bool kernelsMatchScalar(const Matrices::Impl::ElementwiseKernels<T>& kernels, const char* isa_name) {
+        for (auto count = 0UL; count <= 3 * 64 / sizeof(T) + 5; count++) {
+            for (auto offset = 0UL; offset < 2; offset++) {
+                const auto rhs = patterned<T>(count + offset, 3);
+                auto expected = patterned<T>(count + offset, 1);
+                auto actual = expected;
+
+                Matrices::Impl::addScalar(expected.data() + offset, rhs.data() + offset, count);
+                kernels.add(actual.data() + offset, rhs.data() + offset, count);
+                Matrices::Impl::subtractScalar(expected.data() + offset, rhs.data() + offset, count / 2);
+                kernels.subtract(actual.data() + offset, rhs.data() + offset, count / 2);
+                Matrices::Impl::scaleScalar(expected.data() + offset, static_cast<T>(-3), count);
+                kernels.scale(actual.data() + offset, static_cast<T>(-3), count);
+
+                if (actual != expected or not kernels.equal(actual.data() + offset, expected.data() + offset, count)) {
+                    std::print(std::cerr, "Unexpected {} kernel mismatch at count {} offset {}!\n", isa_name, count, offset);
+                    return false;
+                }
+
+                /// NOTE: a single differing element anywhere, including the scalar tail, must break equality.
+                for (auto diff_idx = 0UL; diff_idx < count; diff_idx++) {
+                    actual[offset + diff_idx] += static_cast<T>(1);
+
+                    if (kernels.equal(actual.data() + offset, expected.data() + offset, count)) {
+                        std::print(std::cerr, "Unexpected {} equality with element {} of {} differing!\n", isa_name, diff_idx, count);
+                        return false;
+                    }
+
+                    actual[offset + diff_idx] -= static_cast<T>(1);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    [[nodiscard]] bool allKernelsMatchScalar() {
+        using Kernels = Matrices::Impl::ElementwiseKernels<T>;
+
+        if (not kernelsMatchScalar(Matrices::Impl::elementwiseKernels<T>(), "dispatched")) {
+            return false;
+        }
+
+#if defined(__x86_64__) or defined(__i386__)
+        if (not kernelsMatchScalar(Kernels {&Matrices::Impl::addSse2<T>, &Matrices::Impl::subtractSse2<T>, &Matrices::Impl::scaleSse2<T>, &Matrices::Impl::equalSse2<T>}, "SSE2")) {
+            return false;
+        }
+
+        if (__builtin_cpu_supports("avx2") and not kernelsMatchScalar(Kernels {&Matrices::Impl::addAvx2<T>, &Matrices::Impl::subtractAvx2<T>, &Matrices::Impl::scaleAvx2<T>, &Matrices::Impl::equalAvx2<T>}, "AVX2")) {
+            return false;
+        }
+
+        if (__builtin_cpu_supports("avx512f") and not kernelsMatchScalar(Kernels {&Matrices::Impl::addAvx512<T>, &Matrices::Impl::subtractAvx512<T>, &Matrices::Impl::scaleAvx512<T>, &Matrices::Impl::equalAvx512<T>}, "AVX-512")) {
+            return false;
+        }
+#endif
+
+        return true;
+    }
+}
+
+int main() {
+    if (not allKernelsMatchScalar<float>() or not allKernelsMatchScalar<double>() or not allKernelsMatchScalar<std::int32_t>() or not allKernelsMatchScalar<std::int64_t>()) {
+        return 1;
+    }
+
+    /// NOTE: NaNs never compare equal & signed zeros do, exactly like the scalar loop.
+    Matrices::Matrix<double, 4, 8> lhs_f {1.5};
+    Matrices::Matrix<double, 4, 8> rhs_f {1.5};
+
+    lhs_f[3, 7] = 0.0;
+    rhs_f[3, 7] = -0.0;
+
+    if (lhs_f != rhs_f) {
+        std::print(std::cerr, "Unexpected mismatch of matrices differing only in a signed zero!\n");
+        return 1;
+    }
+
+    lhs_f[2, 2] = std::numeric_limits<double>::quiet_NaN();
+    rhs_f[2, 2] = lhs_f[2, 2];
+
+    if (lhs_f == rhs_f) {
+        std::print(std::cerr, "Unexpected match of matrices holding a NaN!\n");
+        return 1;
+    }
+
+    /// NOTE: the fixed-size operators on the SIMD path, checked against the per-element arithmetic.
+    Matrices::Matrix<std::int32_t, 5, 7> lhs_i {};
+    Matrices::Matrix<std::int32_t, 5, 7> rhs_i {};
+    Matrices::Matrix<std::int32_t, 5, 7> expected_i {};
+
+    for (auto row = 0; row < 5; row++) {
+        for (auto col = 0; col < 7; col++) {
+            lhs_i[row, col] = row - col;
+            rhs_i[row, col] = row * col;
+            expected_i[row, col] = ((row - col) + 2 * (row * col)) * 3;
+        }
+    }
+
+    lhs_i += rhs_i;
+    lhs_i += rhs_i;
+    lhs_i *= 3;
+
+    if (lhs_i != expected_i) {
+        std::print(std::cerr, "Unexpected mismatch of fixed-size int32 element-wise ops!\n");
+        return 1;
+    }
+
+    /// NOTE: the dynamic operators on the SIMD path.
+    Matrices::DynamicMatrix<std::int64_t> dyn_lhs (9, 11, std::int64_t {4});
+    const Matrices::DynamicMatrix<std::int64_t> dyn_rhs (9, 11, std::int64_t {1});
+
+    dyn_lhs -= dyn_rhs;
+    dyn_lhs *= std::int64_t {1} << 40;
+
+    if (dyn_lhs != Matrices::DynamicMatrix<std::int64_t> (9, 11, std::int64_t {3} << 40)) {
+        std::print(std::cerr, "Unexpected mismatch of dynamic int64 element-wise ops!\n");
+        return 1;
+    }
+}
@@ -0,0 +1,89 @@
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <print>
+#include <vector>
+#include "containers/graph.hpp"
+#include "algorithms/rankings.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    /**
+     * @brief Represents a one-way 3-cycle, whose ranks must stay uniform.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> cycle;
+
+    for (auto node = 0; node < 3; node++) {
+        cycle.add(node);
+    }
+
+    for (auto node = 0; node < 3; node++) {
+        cycle.connectAt(node, (node + 1) % 3, EdgeDirection::one_way);
+    }
+
+    if (const auto cycle_ranks = Algorithms::Graph::computePageRank(cycle); std::abs(cycle_ranks.ranks[0] - 1.0 / 3.0) > 1e-9 or std::abs(cycle_ranks.ranks[2] - 1.0 / 3.0) > 1e-9) {
+        std::print(std::cerr, "Unexpected non-uniform PageRank over the 3-cycle.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents pages 1 & 2 linking to page 0, which links nowhere. Closed form: r1 = r2 = (0.15 / 3 + 0.85 r0 / 3), r0 = r1 + 0.85 (r1 + r2), normalized.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> dangling_star;
+
+    for (auto node = 0; node < 3; node++) {
+        dangling_star.add(node);
+    }
+
+    dangling_star.connectAt(1, 0, EdgeDirection::one_way);
+    dangling_star.connectAt(2, 0, EdgeDirection::one_way);
+
+    const auto star_ranks = Algorithms::Graph::computePageRank(dangling_star, {.tolerance = 1e-12, .max_iterations = 500});
+    const auto leaf_rank = star_ranks.ranks[1];
+    const auto expected_hub = leaf_rank + 0.85 * 2.0 * leaf_rank;
+
+    if (std::abs(star_ranks.ranks[0] - expected_hub) > 1e-9 or std::abs(std::accumulate(star_ranks.ranks.cbegin(), star_ranks.ranks.cend(), 0.0) - 1.0) > 1e-9) {
+        std::print(std::cerr, "Unexpected PageRank {} of the dangling hub.\n", star_ranks.ranks[0]);
+        return 1;
+    }
+
+    /**
+     * @brief Represents a pseudo-random graph, checked for agreement between serial & multi-threaded iteration.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> web;
+    unsigned int lcg_state = 5U;
+
+    for (auto node = 0; node < 3000; node++) {
+        web.add(node);
+    }
+
+    for (auto edge = 0; edge < 20000; edge++) {
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        const auto from = static_cast<int>((lcg_state >> 8) % 3000U);
+        lcg_state = lcg_state * 1103515245U + 12345U;
+
+        web.connectAt(from, static_cast<int>((lcg_state >> 8) % 3000U), EdgeDirection::one_way);
+    }
+
+    const auto frozen_web = web.freeze();
+    const auto serial_web = Algorithms::Graph::computePageRank(frozen_web, {.tolerance = 1e-10});
+
+    for (const auto worker_count : {2U, 5U}) {
+        const auto parallel_web = Algorithms::Graph::computePageRank(frozen_web, {.tolerance = 1e-10, .thread_count = worker_count});
+
+        if (parallel_web.iterations != serial_web.iterations) {
+            std::print(std::cerr, "Unexpected iteration count {} with {} workers.\n", parallel_web.iterations, worker_count);
+            return 1;
+        }
+
+        for (auto node = 0; node < 3000; node++) {
+            if (std::abs(parallel_web.ranks[node] - serial_web.ranks[node]) > 1e-12) {
+                std::print(std::cerr, "Unexpected PageRank mismatch at node {} with {} workers.\n", node, worker_count);
+                return 1;
+            }
+        }
+    }
+}
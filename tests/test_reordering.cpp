@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <vector>
+#include "containers/graph.hpp"
+#include "algorithms/reordering.hpp"
+
+template <typename G>
+[[nodiscard]] int bandwidthOf(const G& arg) {
+    auto bandwidth = 0;
+
+    for (auto node = 0; node < static_cast<int>(arg.size()); node++) {
+        for (const auto& edge : arg.neighbors(node)) {
+            bandwidth = std::max(bandwidth, std::abs(node - DerkLib::Containers::Graph::destinationOf(edge)));
+        }
+    }
+
+    return bandwidth;
+}
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+    using ReorderPolicy = Algorithms::Graph::ReorderPolicy;
+    using ChainGraph = Containers::Graph::Graph<EdgeWeightPolicy::weighted, int, Containers::Graph::LookupPolicy::hashed>;
+
+    /**
+     * @brief Represents a 64-node path "0 - 1 - ... - 63" whose nodes were inserted in a scrambled order.
+     */
+    constexpr auto chain_length = 64;
+    ChainGraph chain;
+
+    for (auto step = 0; step < chain_length; step++) {
+        chain.add((step * 37) % chain_length);
+    }
+
+    for (auto link = 0; link + 1 < chain_length; link++) {
+        [[maybe_unused]] auto connected = chain.connect(link, link + 1, link, EdgeDirection::two_way);
+    }
+
+    if (bandwidthOf(chain) < 2) {
+        std::print(std::cerr, "Unexpected narrow bandwidth of the scrambled chain.\n");
+        return 1;
+    }
+
+    const auto old_chain = chain;
+
+    for (const auto policy : {ReorderPolicy::reverse_cuthill_mckee, ReorderPolicy::bfs, ReorderPolicy::degree_descending}) {
+        auto reordered = old_chain;
+        const auto new_indices = Algorithms::Graph::reorderGraph(reordered, policy);
+
+        for (auto old_index = 0; old_index < chain_length; old_index++) {
+            const auto new_index = new_indices[old_index];
+
+            if (reordered.itemAt(new_index) != old_chain.itemAt(old_index) or reordered.indexOf(old_chain.itemAt(old_index)) != new_index) {
+                std::print(std::cerr, "Unexpected item misplacement of {} after reordering.\n", old_chain.itemAt(old_index));
+                return 1;
+            }
+
+            auto old_edges = std::vector<std::pair<int, int>> {};
+            auto new_edges = std::vector<std::pair<int, int>> {};
+
+            for (const auto& [cost, destination] : old_chain.neighbors(old_index)) {
+                old_edges.emplace_back(cost, old_chain.itemAt(destination));
+            }
+
+            for (const auto& [cost, destination] : reordered.neighbors(new_index)) {
+                new_edges.emplace_back(cost, reordered.itemAt(destination));
+            }
+
+            std::ranges::sort(old_edges);
+            std::ranges::sort(new_edges);
+
+            if (old_edges != new_edges) {
+                std::print(std::cerr, "Unexpected edge change around {} after reordering.\n", old_chain.itemAt(old_index));
+                return 1;
+            }
+        }
+    }
+
+    auto banded_chain = old_chain;
+
+    if (Algorithms::Graph::reorderGraph(banded_chain, ReorderPolicy::reverse_cuthill_mckee); bandwidthOf(banded_chain) != 1) {
+        std::print(std::cerr, "Unexpected bandwidth {} of the chain after RCM.\n", bandwidthOf(banded_chain));
+        return 1;
+    }
+
+    /**
+     * @brief Represents a star of 5 leaves around a hub added last, plus a tombstoned stray node. Degree ordering must move the hub to index 0 while the tombstone follows its slot.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::unweighted, int> star;
+
+    for (auto node = 0; node < 7; node++) {
+        star.add(node);
+    }
+
+    for (auto leaf = 0; leaf < 5; leaf++) {
+        star.connectAt(6, leaf, EdgeDirection::two_way);
+    }
+
+    star.removeAt(5);
+
+    const auto star_indices = Algorithms::Graph::reorderGraph(star, ReorderPolicy::degree_descending);
+
+    if (star_indices[6] != 0 or star.itemAt(0) != 6 or not star.isRemoved(star_indices[5]) or star.liveCount() != 6 or star.indexOf(5)) {
+        std::print(std::cerr, "Unexpected star layout after degree ordering.\n");
+        return 1;
+    }
+}
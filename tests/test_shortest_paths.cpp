@@ -0,0 +1,283 @@
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <span>
+#include <sys/resource.h>
+#include <utility>
+#include <vector>
+#include "containers/graph.hpp"
+#include "algorithms/shortest_paths.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeWeightPolicy = Containers::Graph::PathPolicy;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    /**
+     * @brief Represents a small road map where the direct A -> D road (cost 10) loses to A -> B -> C -> D (cost 1 + 2 + 3), and E is unreachable.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, char> roads;
+
+    for (const auto town : {'A', 'B', 'C', 'D', 'E'}) {
+        roads.add(town);
+    }
+
+    if (not roads.connect('A', 'D', 10, EdgeDirection::one_way) or not roads.connect('A', 'B', 1, EdgeDirection::two_way) or not roads.connect('B', 'C', 2, EdgeDirection::two_way) or not roads.connect('C', 'D', 3, EdgeDirection::one_way) or not roads.connect('A', 'C', 5, EdgeDirection::one_way)) {
+        std::print(std::cerr, "Unexpected failure of connecting roads.\n");
+        return 1;
+    }
+
+    const auto road_paths = Algorithms::Graph::searchDijkstra(roads, 0);
+    const std::vector<long long> expected_distances {0, 1, 3, 6, Algorithms::Graph::unreachable_cost<long long>};
+
+    if (road_paths.distances != expected_distances) {
+        std::print(std::cerr, "Unexpected Dijkstra distances over roads.\n");
+        return 1;
+    }
+
+    if (Algorithms::Graph::tracePath(road_paths.parents, 0, 3) != std::vector<int> {0, 1, 2, 3} or not Algorithms::Graph::tracePath(road_paths.parents, 0, 4).empty()) {
+        std::print(std::cerr, "Unexpected traced path over roads.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a pseudo-random weighted graph whose Dijkstra distances are checked against a Bellman-Ford relaxation.
+     */
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, int> mesh;
+    constexpr auto mesh_size = 300;
+    unsigned int lcg_state = 2024U;
+
+    auto nextRandom = [&lcg_state](unsigned int bound) noexcept {
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        return static_cast<int>((lcg_state >> 8) % bound);
+    };
+
+    for (auto node = 0; node < mesh_size; node++) {
+        mesh.add(node);
+    }
+
+    for (auto edge = 0; edge < mesh_size * 6; edge++) {
+        mesh.connectAt(nextRandom(mesh_size), nextRandom(mesh_size), nextRandom(100), EdgeDirection::one_way);
+    }
+
+    std::vector<long long> relaxed (mesh_size, Algorithms::Graph::unreachable_cost<long long>);
+    relaxed[0] = 0;
+
+    for (auto round = 0; round < mesh_size; round++) {
+        for (auto node = 0; node < mesh_size; node++) {
+            if (relaxed[node] == Algorithms::Graph::unreachable_cost<long long>) {
+                continue;
+            }
+
+            for (const auto& [cost, adj_index] : mesh.neighbors(node)) {
+                relaxed[adj_index] = std::min(relaxed[adj_index], relaxed[node] + cost);
+            }
+        }
+    }
+
+    const auto mesh_paths = Algorithms::Graph::searchDijkstra(mesh.freeze(), 0);
+
+    if (mesh_paths.distances != relaxed) {
+        std::print(std::cerr, "Unexpected mismatch between Dijkstra & Bellman-Ford over mesh.\n");
+        return 1;
+    }
+
+    for (auto node = 1; node < mesh_size; node++) {
+        if (const auto parent = mesh_paths.parents[node]; parent != Algorithms::Graph::no_node and mesh_paths.distances[parent] > mesh_paths.distances[node]) {
+            std::print(std::cerr, "Unexpected Dijkstra parent {} of node {}.\n", parent, node);
+            return 1;
+        }
+    }
+
+    for (const auto worker_count : {1U, 3U, 4U}) {
+        for (const auto delta : {0LL, 1LL, 25LL, 1000LL}) {
+            const auto stepped_paths = Algorithms::Graph::searchDeltaStepping(mesh, 0, delta, worker_count);
+
+            if (stepped_paths.distances != mesh_paths.distances) {
+                std::print(std::cerr, "Unexpected mismatch between delta-stepping (delta {}, {} workers) & Dijkstra over mesh.\n", delta, worker_count);
+                return 1;
+            }
+
+            for (auto node = 1; node < mesh_size; node++) {
+                if (const auto parent = stepped_paths.parents[node]; parent != Algorithms::Graph::no_node and stepped_paths.distances[parent] > stepped_paths.distances[node]) {
+                    std::print(std::cerr, "Unexpected delta-stepping parent {} of node {}.\n", parent, node);
+                    return 1;
+                }
+            }
+        }
+    }
+
+    if (Algorithms::Graph::searchDeltaStepping(roads, 0, 2LL, 2U).distances != expected_distances) {
+        std::print(std::cerr, "Unexpected delta-stepping distances over roads.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a chain with real-valued costs searched with a tiny `delta`, which must be clamped instead of allocating `max_cost / delta` buckets.
+     */
+    {
+        std::vector<int> chain_nodes {0, 1, 2, 3};
+        std::vector<Containers::Graph::IndexCostEdgeOf<double>> chain_edges {{0, 1, 1.5}, {1, 2, 2.25}, {0, 2, 4.0}, {2, 3, 0.5}};
+        const auto real_chain = Containers::Graph::buildCsrGraph(std::span {chain_nodes}, std::span {chain_edges});
+
+        if (not real_chain or Algorithms::Graph::searchDeltaStepping(*real_chain, 0, 1e-9, 2U).distances != Algorithms::Graph::searchDijkstra(*real_chain, 0).distances) {
+            std::print(std::cerr, "Unexpected delta-stepping distances over the real-valued chain with a tiny delta.\n");
+            return 1;
+        }
+    }
+
+    /**
+     * @brief Represents a star of 2^20 leaves with distinct costs, searched by 16 workers with `delta` = 1. The bucket ring is capped, so the search must not grow the peak resident set by anything close to the `16 * node_count` empty buckets an uncapped ring would allocate (~400 MB).
+     */
+    {
+        constexpr int leaf_count = 1 << 20;
+        std::vector<int> star_nodes (leaf_count + 1);
+        std::vector<Containers::Graph::IndexCostEdgeOf<int>> star_edges;
+
+        star_edges.reserve(leaf_count);
+
+        for (auto leaf = 1; leaf <= leaf_count; leaf++) {
+            star_nodes[leaf] = leaf;
+            star_edges.emplace_back(0, leaf, leaf);
+        }
+
+        const auto star = Containers::Graph::buildCsrGraph(std::span {star_nodes}, std::span {star_edges});
+        auto peakKilobytes = []() noexcept {
+            rusage usage {};
+
+            getrusage(RUSAGE_SELF, &usage);
+
+            return usage.ru_maxrss;
+        };
+
+        if (not star) {
+            std::print(std::cerr, "Unexpected failure of building the star.\n");
+            return 1;
+        }
+
+        const auto peak_before = peakKilobytes();
+        const auto star_paths = Algorithms::Graph::searchDeltaStepping(*star, 0, 1, 16U);
+        const auto peak_growth = peakKilobytes() - peak_before;
+
+        if (star_paths.distances != Algorithms::Graph::searchDijkstra(*star, 0).distances) {
+            std::print(std::cerr, "Unexpected delta-stepping distances over the star with a tiny delta.\n");
+            return 1;
+        }
+
+        /// NOTE: ThreadSanitizer shadows every byte several times over, so the resident set says nothing there.
+#if not defined(__SANITIZE_THREAD__)
+        if (peak_growth > 128 * 1024) {
+            std::print(std::cerr, "Unexpected peak memory growth of {} KiB for delta-stepping over the star.\n", peak_growth);
+            return 1;
+        }
+#else
+        static_cast<void>(peak_growth);
+#endif
+    }
+    /**
+     * @brief Checks point-to-point searches over mesh against full Dijkstra & BFS runs, reusing one workspace per search kind. Each returned route must follow real edges and add up to the reported distance.
+     */
+    const auto frozen_mesh = mesh.freeze();
+    const auto reverse_mesh = Containers::Graph::transposeOf(frozen_mesh);
+    Algorithms::Graph::PathWorkspace<long long> mesh_workspace (mesh_size);
+    Algorithms::Graph::PathWorkspace<int> hop_workspace (mesh_size);
+    std::vector<int> route;
+
+    auto routeCost = [&frozen_mesh](const std::vector<int>& path) {
+        auto total = 0LL;
+
+        for (std::size_t step = 1; step < path.size(); step++) {
+            auto cheapest = Algorithms::Graph::unreachable_cost<long long>;
+
+            for (const auto& [cost, adj_index] : frozen_mesh.neighbors(path[step - 1])) {
+                if (adj_index == path[step]) {
+                    cheapest = std::min(cheapest, static_cast<long long>(cost));
+                }
+            }
+
+            if (cheapest == Algorithms::Graph::unreachable_cost<long long>) {
+                return cheapest;
+            }
+
+            total += cheapest;
+        }
+
+        return total;
+    };
+
+    for (auto source = 0; source < mesh_size; source += 37) {
+        const auto source_paths = Algorithms::Graph::searchDijkstra(frozen_mesh, source);
+        const auto source_levels = Algorithms::Graph::searchBFS(frozen_mesh, source).levels;
+
+        for (auto target = 0; target < mesh_size; target += 7) {
+            const auto expected = source_paths.distances[target];
+            const auto reachable = expected != Algorithms::Graph::unreachable_cost<long long>;
+            const auto greedy = Algorithms::Graph::searchAStar(frozen_mesh, source, target, []([[maybe_unused]] int item, [[maybe_unused]] int goal) noexcept { return 0; }, mesh_workspace);
+
+            if (mesh_workspace.pathInto(route); greedy != expected or (reachable and (route.front() != source or route.back() != target or routeCost(route) != expected))) {
+                std::print(std::cerr, "Unexpected A* result from {} to {}.\n", source, target);
+                return 1;
+            }
+
+            const auto meeting = Algorithms::Graph::searchBidirectionalDijkstra(frozen_mesh, reverse_mesh, source, target, mesh_workspace);
+
+            if (mesh_workspace.pathInto(route); meeting != expected or (reachable and (route.front() != source or route.back() != target or routeCost(route) != expected))) {
+                std::print(std::cerr, "Unexpected bidirectional Dijkstra result from {} to {}.\n", source, target);
+                return 1;
+            }
+
+            if (const auto hops = Algorithms::Graph::searchBidirectionalBFS(frozen_mesh, reverse_mesh, source, target, hop_workspace); hops != source_levels[target]) {
+                std::print(std::cerr, "Unexpected bidirectional BFS hops {} from {} to {}.\n", hops, source, target);
+                return 1;
+            }
+
+            if (hop_workspace.pathInto(route); reachable and static_cast<int>(route.size()) != source_levels[target] + 1) {
+                std::print(std::cerr, "Unexpected bidirectional BFS route length from {} to {}.\n", source, target);
+                return 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Represents a 40x40 grid of two-way streets costing 1 to 3 per block, so the Manhattan distance between cells never overestimates.
+     */
+    using Cell = std::pair<int, int>;
+
+    constexpr auto grid_side = 40;
+    Containers::Graph::Graph<EdgeWeightPolicy::weighted, Cell> grid;
+
+    for (auto row = 0; row < grid_side; row++) {
+        for (auto column = 0; column < grid_side; column++) {
+            grid.add(Cell {row, column});
+        }
+    }
+
+    for (auto cell = 0; cell < grid_side * grid_side; cell++) {
+        if (cell % grid_side + 1 < grid_side) {
+            grid.connectAt(cell, cell + 1, 1 + nextRandom(3), EdgeDirection::two_way);
+        }
+
+        if (cell + grid_side < grid_side * grid_side) {
+            grid.connectAt(cell, cell + grid_side, 1 + nextRandom(3), EdgeDirection::two_way);
+        }
+    }
+
+    auto manhattan = [](const Cell& cell, const Cell& goal) noexcept {
+        return std::abs(cell.first - goal.first) + std::abs(cell.second - goal.second);
+    };
+
+    Algorithms::Graph::PathWorkspace<long long> grid_workspace;
+    const auto corner_paths = Algorithms::Graph::searchDijkstra(grid, 0);
+
+    for (auto target = 0; target < grid_side * grid_side; target += 53) {
+        if (Algorithms::Graph::searchAStar(grid, 0, target, manhattan, grid_workspace) != corner_paths.distances[target]) {
+            std::print(std::cerr, "Unexpected Manhattan A* distance to cell {}.\n", target);
+            return 1;
+        }
+
+        if (Algorithms::Graph::searchBidirectionalDijkstra(grid, grid, 0, target, grid_workspace) != corner_paths.distances[target]) {
+            std::print(std::cerr, "Unexpected bidirectional Dijkstra distance to cell {}.\n", target);
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <iostream>
+#include <print>
+#include <span>
+#include <vector>
+#include "containers/graph.hpp"
+#include "algorithms/subgraphs.hpp"
+
+int main() {
+    using namespace DerkLib;
+    using EdgeDirection = Containers::Graph::DirectFlag;
+
+    unsigned int lcg_state = 31U;
+
+    auto nextRandom = [&lcg_state](unsigned int bound) noexcept {
+        lcg_state = lcg_state * 1103515245U + 12345U;
+        return static_cast<int>((lcg_state >> 8) % bound);
+    };
+
+    /**
+     * @brief Checks the dispatched intersection kernel against the scalar merge over runs of every length around the SIMD block widths.
+     */
+    for (auto round = 0; round < 400; round++) {
+        std::vector<int> lhs;
+        std::vector<int> rhs;
+
+        for (auto value = 0, lhs_size = nextRandom(40), rhs_size = nextRandom(40); value < 120; value++) {
+            if (nextRandom(120) < lhs_size) {
+                lhs.emplace_back(value);
+            }
+
+            if (nextRandom(120) < rhs_size) {
+                rhs.emplace_back(value);
+            }
+        }
+
+        if (Algorithms::Graph::Impl::countCommon(lhs, rhs) != Algorithms::Graph::Impl::countCommonScalar(lhs.data(), lhs.size(), rhs.data(), rhs.size())) {
+            std::print(std::cerr, "Unexpected SIMD intersection count in round {}.\n", round);
+            return 1;
+        }
+    }
+
+    /**
+     * @brief Represents a random undirected graph, whose triangle counts are checked against brute-force adjacency-matrix counting.
+     */
+    constexpr auto node_count = 150;
+    std::vector<int> nodes (node_count);
+    std::vector<Containers::Graph::IndexEdge> links;
+    std::vector<std::vector<bool>> adjacent (node_count, std::vector<bool>(node_count, false));
+
+    for (auto node = 0; node < node_count; node++) {
+        nodes[node] = node;
+    }
+
+    for (auto link = 0; link < node_count * 8; link++) {
+        const auto from = nextRandom(node_count);
+        const auto to = nextRandom(node_count);
+
+        if (from != to) {
+            links.emplace_back(from, to);
+            adjacent[from][to] = true;
+            adjacent[to][from] = true;
+        }
+    }
+
+    const auto social = Containers::Graph::buildCsrGraph(std::span {nodes}, std::span {links}, {.direction = EdgeDirection::two_way, .deduplicate = true});
+    std::vector<long long> expected_counts (node_count, 0);
+    long long expected_total = 0;
+
+    for (auto first = 0; first < node_count; first++) {
+        for (auto second = first + 1; second < node_count; second++) {
+            for (auto third = second + 1; third < node_count; third++) {
+                if (adjacent[first][second] and adjacent[second][third] and adjacent[first][third]) {
+                    ++expected_counts[first];
+                    ++expected_counts[second];
+                    ++expected_counts[third];
+                    ++expected_total;
+                }
+            }
+        }
+    }
+
+    for (const auto worker_count : {1U, 3U}) {
+        const auto triangles = Algorithms::Graph::countTriangles(*social, worker_count);
+
+        if (triangles.per_node != expected_counts or triangles.total != expected_total) {
+            std::print(std::cerr, "Unexpected triangle counts with {} workers: total {} vs {}.\n", worker_count, triangles.total, expected_total);
+            return 1;
+        }
+    }
+
+    /**
+     * @brief Checks core numbers against naive peeling: repeatedly strip every node of degree `< k` & record `k - 1` for it.
+     */
+    std::vector<int> expected_cores (node_count, 0);
+    std::vector<bool> stripped (node_count, false);
+
+    for (auto k = 1, remaining = node_count; remaining > 0; k++) {
+        for (auto changed = true; changed; ) {
+            changed = false;
+
+            for (auto node = 0; node < node_count; node++) {
+                if (stripped[node]) {
+                    continue;
+                }
+
+                auto live_degree = 0;
+
+                for (const auto adj_index : social->targetsOf(node)) {
+                    live_degree += stripped[adj_index] ? 0 : 1;
+                }
+
+                if (live_degree < k) {
+                    stripped[node] = true;
+                    expected_cores[node] = k - 1;
+                    --remaining;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    if (Algorithms::Graph::decomposeCores(*social) != expected_cores) {
+        std::print(std::cerr, "Unexpected core numbers of the random graph.\n");
+        return 1;
+    }
+
+    /**
+     * @brief Represents a 4-clique {0, 1, 2, 3} with a pendant path 3 - 4 - 5.
+     */
+    Containers::Graph::Graph<Containers::Graph::PathPolicy::unweighted, int> clique_tail;
+
+    for (auto node = 0; node < 6; node++) {
+        clique_tail.add(node);
+    }
+
+    for (auto first = 0; first < 4; first++) {
+        for (auto second = first + 1; second < 4; second++) {
+            clique_tail.connectAt(first, second, EdgeDirection::two_way);
+        }
+    }
+
+    clique_tail.connectAt(3, 4, EdgeDirection::two_way);
+    clique_tail.connectAt(4, 5, EdgeDirection::two_way);
+
+    if (Algorithms::Graph::decomposeCores(clique_tail) != std::vector<int> {3, 3, 3, 3, 1, 1}) {
+        std::print(std::cerr, "Unexpected core numbers of the clique with a tail.\n");
+        return 1;
+    }
+}